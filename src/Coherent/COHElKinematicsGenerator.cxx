@@ -228,13 +228,13 @@ double COHElKinematicsGenerator::Energy(const Interaction * interaction) const
 //___________________________________________________________________________
 void COHElKinematicsGenerator::Configure(const Registry & config)
 {
-  Algorithm::Configure(config);
+  KineGeneratorWithCache::Configure(config);
   this->LoadConfig();
 }
 //____________________________________________________________________________
 void COHElKinematicsGenerator::Configure(string config)
 {
-  Algorithm::Configure(config);
+  KineGeneratorWithCache::Configure(config);
   this->LoadConfig();
 }
 //____________________________________________________________________________
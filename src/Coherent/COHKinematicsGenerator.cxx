@@ -321,13 +321,13 @@ double COHKinematicsGenerator::Energy(const Interaction * interaction) const
 //___________________________________________________________________________
 void COHKinematicsGenerator::Configure(const Registry & config)
 {
-  Algorithm::Configure(config);
+  KineGeneratorWithCache::Configure(config);
   this->LoadConfig();
 }
 //____________________________________________________________________________
 void COHKinematicsGenerator::Configure(string config)
 {
-  Algorithm::Configure(config);
+  KineGeneratorWithCache::Configure(config);
   this->LoadConfig();
 }
 //____________________________________________________________________________
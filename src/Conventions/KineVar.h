@@ -40,7 +40,8 @@ typedef enum EKineVar {
   kKVSelQ2,
   kKVSelq2,
   kKVSelW,
-  kKVSelt
+  kKVSelt,
+  kNKineVar   ///< number of kinematic variables (not a variable)
 
 } KineVar_t;
 
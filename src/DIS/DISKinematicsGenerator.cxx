@@ -211,13 +211,13 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 //___________________________________________________________________________
 void DISKinematicsGenerator::Configure(const Registry & config)
 {
-  Algorithm::Configure(config);
+  KineGeneratorWithCache::Configure(config);
   this->LoadConfig();
 }
 //____________________________________________________________________________
 void DISKinematicsGenerator::Configure(string config)
 {
-  Algorithm::Configure(config);
+  KineGeneratorWithCache::Configure(config);
   this->LoadConfig();
 }
 //____________________________________________________________________________
@@ -186,19 +186,14 @@ TClonesArray * BaryonResonanceDecayer::DecayExclusive(
   bool is_permitted = fPhaseSpaceGenerator.SetDecay(p, nd, mass);
   assert(is_permitted);
 
-  //double wmax = fPhaseSpaceGenerator.GetWtMax();
-  double wmax = -1;
-  for(int i=0; i<50; i++) {
-     double w = fPhaseSpaceGenerator.Generate();
-     wmax = TMath::Max(wmax,w);
-  }
-  assert(wmax>0);
-  LOG("Decay", pINFO)
-     << "Max phase space gen. weight for current decay: " << wmax;
-
   if(fGenerateWeighted)
   {
      // *** generating weighted decays ***
+     double wmax = fPhaseSpaceGenerator.MaxWeight();
+     assert(wmax>0);
+     LOG("Decay", pINFO)
+        << "Max phase space gen. weight for current decay: " << wmax;
+
      double w = fPhaseSpaceGenerator.Generate();
      fWeight *= TMath::Max(w/wmax, 1.);
   }
@@ -206,27 +201,9 @@ TClonesArray * BaryonResonanceDecayer::DecayExclusive(
   {
      // *** generating un-weighted decays ***
      RandomGen * rnd = RandomGen::Instance();
-     wmax *= 2;
-     bool accept_decay=false;
-     register unsigned int itry=0;
-
-     while(!accept_decay)
-     {
-       itry++;
-       assert(itry<kMaxUnweightDecayIterations);
-
-       double w  = fPhaseSpaceGenerator.Generate();
-       double gw = wmax * rnd->RndDec().Rndm();
-
-       if(w>wmax) {
-          LOG("Decay", pWARN) 
-             << "Current decay weight = " << w << " > wmax = " << wmax;
-       }
-       LOG("Decay", pINFO) 
-          << "Current decay weight = " << w << " / R = " << gw;
-
-       accept_decay = (gw<=w);
-     }
+     bool accept_decay = 
+        fPhaseSpaceGenerator.GenerateUnweighted(rnd->RndDec(), 2.);
+     assert(accept_decay);
   }
 
   //-- Create the event record
@@ -25,10 +25,10 @@
 #ifndef _BARYON_RESONANCE_DECAYER_H_
 #define _BARYON_RESONANCE_DECAYER_H_
 
-#include <TGenPhaseSpace.h>
 #include <TLorentzVector.h>
 
 #include "Decay/DecayModelI.h"
+#include "Utils/NBodyPhaseSpace.h"
 
 namespace genie {
 
@@ -58,8 +58,8 @@ private:
   TClonesArray * DecayExclusive (int pdgc, TLorentzVector & p, TDecayChannel * ch) const;
   double         FinalStateMass (TDecayChannel * channel) const;
 
-  mutable TGenPhaseSpace fPhaseSpaceGenerator;
-  mutable double         fWeight;
+  mutable NBodyPhaseSpace fPhaseSpaceGenerator;
+  mutable double          fWeight;
 
   bool fGenerateWeighted;
 };
@@ -226,13 +226,13 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 //___________________________________________________________________________
 void DFRKinematicsGenerator::Configure(const Registry & config)
 {
-  Algorithm::Configure(config);
+  KineGeneratorWithCache::Configure(config);
   this->LoadConfig();
 }
 //____________________________________________________________________________
 void DFRKinematicsGenerator::Configure(string config)
 {
-  Algorithm::Configure(config);
+  KineGeneratorWithCache::Configure(config);
   this->LoadConfig();
 }
 //____________________________________________________________________________
@@ -0,0 +1,97 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+         Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+         STFC, Rutherford Appleton Laboratory
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include "EVGCore/EventRecord.h"
+#include "EVGCore/EventRecordPool.h"
+#include "Interaction/Interaction.h"
+#include "Messenger/Messenger.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+EventRecordPool * EventRecordPool::fInstance = 0;
+//____________________________________________________________________________
+EventRecordPool::EventRecordPool() :
+fMaxSize(16)
+{
+  fInstance =  0;
+}
+//____________________________________________________________________________
+EventRecordPool::~EventRecordPool()
+{
+  this->Clear();
+  fInstance = 0;
+}
+//____________________________________________________________________________
+EventRecordPool * EventRecordPool::Instance()
+{
+  if(fInstance == 0) {
+    static EventRecordPool::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new EventRecordPool;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+EventRecord * EventRecordPool::Get(void)
+{
+  EventRecord * evrec = 0;
+
+  if(fFree.size() > 0) {
+    evrec = fFree.back();
+    fFree.pop_back();
+  } else {
+    evrec = new EventRecord;
+  }
+
+  // make sure there is a summary to overwrite
+  if(!evrec->Summary()) evrec->AttachSummary(new Interaction);
+
+  return evrec;
+}
+//____________________________________________________________________________
+void EventRecordPool::Release(EventRecord * evrec)
+{
+  if(!evrec) return;
+
+  if(fFree.size() >= fMaxSize) {
+    delete evrec;
+    return;
+  }
+
+  evrec->ReuseRecord();
+  fFree.push_back(evrec);
+}
+//____________________________________________________________________________
+void EventRecordPool::SetMaxSize(unsigned int n)
+{
+  fMaxSize = n;
+  while(fFree.size() > fMaxSize) {
+    delete fFree.back();
+    fFree.pop_back();
+  }
+}
+//____________________________________________________________________________
+void EventRecordPool::Clear(void)
+{
+  vector<EventRecord *>::iterator it = fFree.begin();
+  for( ; it != fFree.end(); ++it) {
+    delete *it;
+  }
+  fFree.clear();
+}
+//____________________________________________________________________________
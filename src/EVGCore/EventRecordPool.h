@@ -0,0 +1,85 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::EventRecordPool
+
+\brief    A pool of recycled event records.
+          Event generation drivers take the EventRecord they bootstrap from
+          the pool (Get()) rather than creating a new one. Clients that are
+          done with an event (eg once it was added to the output ntuple) can
+          hand it back (Release()) rather than deleting it. Released records
+          are reset with GHepRecord::ReuseRecord(), which keeps the already
+          allocated particle slots, summary Interaction, vertex and flags, so
+          that long production runs do not construct and destroy an event
+          record (and all its sub-objects) for every generated event.
+          Deleting an event obtained from the pool is still allowed.
+
+\author   The GENIE Collaboration
+          Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+          STFC, Rutherford Appleton Laboratory
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _EVENT_RECORD_POOL_H_
+#define _EVENT_RECORD_POOL_H_
+
+#include <vector>
+
+using std::vector;
+
+namespace genie {
+
+class EventRecord;
+
+class EventRecordPool
+{
+public:
+  static EventRecordPool * Instance (void);
+
+  //! Get an empty event record (a recycled one if available).
+  //! The record always carries a summary Interaction, to be overwritten
+  //! (eg with Interaction::Copy()). The caller adopts the event record.
+  EventRecord * Get (void);
+
+  //! Hand back an event record for recycling. The pool adopts the record.
+  void Release (EventRecord * evrec);
+
+  //! Max number of records kept for recycling (extra records are deleted)
+  void         SetMaxSize (unsigned int n);
+  unsigned int MaxSize    (void) const { return fMaxSize;     }
+  unsigned int NFree      (void) const { return fFree.size(); }
+
+  //! Delete all records kept for recycling
+  void Clear (void);
+
+private:
+  EventRecordPool();
+  EventRecordPool(const EventRecordPool & pool);
+ ~EventRecordPool();
+
+  static EventRecordPool * fInstance;
+
+  vector<EventRecord *> fFree;    ///< records available for recycling
+  unsigned int          fMaxSize; ///< max number of records kept
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (EventRecordPool::fInstance !=0) {
+            delete EventRecordPool::fInstance;
+            EventRecordPool::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _EVENT_RECORD_POOL_H_
@@ -14,6 +14,7 @@
 */
 //____________________________________________________________________________
 
+#include <cstdlib>
 #include <iomanip>
 
 #include <TMath.h>
@@ -40,6 +41,8 @@ namespace genie {
  }
 }
 //___________________________________________________________________________
+unsigned long InteractionGeneratorMap::fLastId = 0;
+//___________________________________________________________________________
 InteractionGeneratorMap::InteractionGeneratorMap() :
 map<string, const EventGeneratorI *> ()
 {
@@ -70,6 +73,8 @@ void InteractionGeneratorMap::Init(void)
 
   fInitState       = new InitialState;
   fInteractionList = new InteractionList;
+
+  fId = ++fLastId;
 }
 //___________________________________________________________________________
 void InteractionGeneratorMap::CleanUp(void)
@@ -78,6 +83,7 @@ void InteractionGeneratorMap::CleanUp(void)
   delete fInteractionList;
 
   this->clear();
+  fGeneratorIndex.clear();
 }
 //___________________________________________________________________________
 void InteractionGeneratorMap::Copy(const InteractionGeneratorMap & xsmap)
@@ -97,6 +103,9 @@ void InteractionGeneratorMap::Copy(const InteractionGeneratorMap & xsmap)
 
     this->insert(map<string, const EventGeneratorI *>::value_type(code,evg));
   }
+  fGeneratorIndex = xsmap.fGeneratorIndex;
+
+  fId = ++fLastId;
 }
 //___________________________________________________________________________
 void InteractionGeneratorMap::UseGeneratorList(const EventGeneratorList * l)
@@ -118,6 +127,8 @@ void InteractionGeneratorMap::BuildMap(const InitialState & init_state)
 
   fInitState->Copy(init_state);
 
+  fId = ++fLastId;
+
   EventGeneratorList::const_iterator evgliter; // event generator list iter
   InteractionList::iterator          intliter; // interaction list iter
 
@@ -149,11 +160,22 @@ void InteractionGeneratorMap::BuildMap(const InitialState & init_state)
         // current interaction
         Interaction * interaction = *intliter;
         string code = interaction->AsString();
+        ULong64_t icode = interaction->Code();
+
+        // distinct interactions must not share the same integer code
+        if(this->count(code) == 0 && fGeneratorIndex.count(icode) != 0) {
+          LOG("IntGenMap", pFATAL)
+             << "Interaction code collision for: " << code;
+          gAbortingInErr = true;
+          exit(1);
+        }
 
         SLOG("IntGenMap", pDEBUG)
               << "\nLinking: " << code << " --> to: " << evgen->Id().Key();
         this->insert(
              map<string, const EventGeneratorI *>::value_type(code,evgen));
+        fGeneratorIndex.insert(
+             map<ULong64_t, const EventGeneratorI *>::value_type(icode,evgen));
      } // loop over interactions
      delete ilst;
      ilst = 0;
@@ -167,11 +189,12 @@ const EventGeneratorI * InteractionGeneratorMap::FindGenerator(
     LOG("IntGenMap", pWARN) << "Null interaction!!";
     return 0;
   }
-  string code = interaction->AsString();
-  InteractionGeneratorMap::const_iterator evgiter = this->find(code);
-  if(evgiter == this->end()) {
+  map<ULong64_t, const EventGeneratorI *>::const_iterator evgiter = 
+                                 fGeneratorIndex.find(interaction->Code());
+  if(evgiter == fGeneratorIndex.end()) {
     LOG("IntGenMap", pWARN)
-             << "No EventGeneratorI was found for interaction: \n" << code;
+             << "No EventGeneratorI was found for interaction: \n" 
+             << interaction->AsString();
     return 0;
   }
   const EventGeneratorI * evg = evgiter->second;
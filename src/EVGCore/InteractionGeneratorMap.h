@@ -7,6 +7,8 @@
          The container is being built for the loaded EventGeneratorList and for 
          the input InitialState object and is being used to locate the generator
          that can generate aany given interaction.
+         The container is keyed by Interaction::AsString() (used for printing)
+         while look-ups go through an index keyed by Interaction::Code().
 
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          STFC, Rutherford Appleton Laboratory
@@ -56,6 +58,10 @@ public :
   void Copy  (const InteractionGeneratorMap & xsmap);
   void Print (ostream & stream) const;
 
+  //! Unique id, renewed whenever the map contents change (unlike the
+  //! object address, it is never re-used by another map)
+  unsigned long Id (void) const { return fId; }
+
   InteractionGeneratorMap & operator =  (const InteractionGeneratorMap & xsmap);
   friend ostream & operator << (ostream & stream, const InteractionGeneratorMap & xsmap);
 
@@ -68,6 +74,11 @@ private:
 
   InitialState *    fInitState;
   InteractionList * fInteractionList;
+
+  map<ULong64_t, const EventGeneratorI *> fGeneratorIndex; ///< Interaction::Code() -> generator
+
+  unsigned long        fId;     ///< unique id of the current map contents
+  static unsigned long fLastId; ///< last id given to any map
 };
 
 }      // genie namespace
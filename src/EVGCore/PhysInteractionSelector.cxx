@@ -21,8 +21,10 @@
 //____________________________________________________________________________
 
 #include <vector>
+#include <algorithm>
 #include <sstream>
 #include <cstdlib>
+#include <cassert>
 #include <iomanip>
 
 #include <TMath.h>
@@ -32,6 +34,7 @@
 #include "Conventions/Units.h"
 #include "EVGCore/PhysInteractionSelector.h"
 #include "EVGCore/EventRecord.h"
+#include "EVGCore/EventRecordPool.h"
 #include "EVGCore/EventGeneratorI.h"
 #include "EVGCore/InteractionList.h"
 #include "EVGCore/InteractionGeneratorMap.h"
@@ -52,20 +55,26 @@ using namespace genie::units;
 
 //___________________________________________________________________________
 PhysInteractionSelector::PhysInteractionSelector() :
-InteractionSelectorI("genie::PhysInteractionSelector")
+InteractionSelectorI("genie::PhysInteractionSelector"),
+fTableIGMapId(0),
+fTableSplGen(0),
+fInteraction(0)
 {
 
 }
 //___________________________________________________________________________
 PhysInteractionSelector::PhysInteractionSelector(string config) :
-InteractionSelectorI("genie::PhysInteractionSelector", config)
+InteractionSelectorI("genie::PhysInteractionSelector", config),
+fTableIGMapId(0),
+fTableSplGen(0),
+fInteraction(0)
 {
 
 }
 //___________________________________________________________________________
 PhysInteractionSelector::~PhysInteractionSelector()
 {
-
+  if(fInteraction) delete fInteraction;
 }
 //___________________________________________________________________________
 EventRecord * PhysInteractionSelector::SelectInteraction
@@ -82,142 +91,200 @@ EventRecord * PhysInteractionSelector::SelectInteraction
      return 0;
   }
 
+  const InteractionList & ilst = igmap->GetInteractionList();
+  unsigned int nint = ilst.size();
+
   // Get the list of spline objects
   // Should have been constructed at the job initialization
   XSecSplineList * xssl = 0;
   if (fUseSplines) xssl = XSecSplineList::Instance();
 
-  const InteractionList & ilst = igmap->GetInteractionList();
-  vector<double> xseclist(ilst.size());
+  // Compile the selection table the first time this interaction generator
+  // map is seen, or if the spline list was reloaded since (the table holds
+  // Spline pointers)
+  bool rebuild = (igmap->Id() != fTableIGMapId);
+  if(xssl && xssl->Generation() != fTableSplGen) rebuild = true;
+  if(rebuild) {
+     this->BuildSelectionTable(igmap);
+  }
 
-  string istate = ilst[0]->InitState().AsString();
-  ostringstream msg;
-  msg << "Selecting an interaction for the given initial state = "
-      << istate << " at E = " << p4.E() << " GeV";
+  // The xsec table is only built if it is going to be printed-out
+  bool print_table = MESG_ENABLED("IntSel", pNOTICE);
 
-  LOG("IntSel", pNOTICE)
-             << utils::print::PrintFramedMesg(msg.str(), 0, '=');
-  LOG("IntSel", pNOTICE)
-     << "Computing xsecs for all relevant modeled interactions:";
+  ostringstream xsec_table_printout;
 
-  unsigned int i=0;
-  InteractionList::const_iterator intliter = ilst.begin(); 
+  if(print_table) {
+    string istate = ilst[0]->InitState().AsString();
+    ostringstream msg;
+    msg << "Selecting an interaction for the given initial state = "
+        << istate << " at E = " << p4.E() << " GeV";
 
-  ostringstream xsec_table_printout;
+    LOG("IntSel", pNOTICE)
+             << utils::print::PrintFramedMesg(msg.str(), 0, '=');
+    LOG("IntSel", pNOTICE)
+       << "Computing xsecs for all relevant modeled interactions:";
 
-  xsec_table_printout 
+    xsec_table_printout 
       << " |"  << setfill('-') << setw(112) << "|" << endl     
       << " | " << setfill(' ') << setw(80) << "interaction"
       << " | cross-section (1E-38*cm^2) |" << endl
       << " |"  << setfill('-') << setw(112) << "|" << endl;
+  }
 
-  for( ; intliter != ilst.end(); ++intliter) {
+  double xsec_sum = 0;
 
-     Interaction * interaction = new Interaction(**intliter);
-     interaction->InitStatePtr()->SetProbeP4(p4);
+  for(unsigned int i = 0; i < nint; i++) {
 
-     SLOG("IntSel", pDEBUG)
-           << "Computing xsec for: \n  " << interaction->AsString();
+     const Spline * spl = fXSecSpl[i];
 
-     // get the cross section for this interaction
-     const XSecAlgorithmI * xsec_alg =
-               igmap->FindGenerator(interaction)->CrossSectionAlg();
-     assert(xsec_alg);
+     // pick-up any spline that was created after the table was compiled
+     if(!spl && fUseSplines) {
+        if(xssl->SplineExists(fXSecAlg[i], ilst[i])) {
+          spl = xssl->GetSpline(fXSecAlg[i], ilst[i]);
+          fXSecSpl[i] = spl;
+        }
+     }
 
      double xsec = 0; // cross section for this interaction
 
-     bool spline_computed = xssl->SplineExists(xsec_alg, interaction);
-     bool eval = fUseSplines && spline_computed;
-     if (eval) {
-           const InitialState & init = interaction->InitState();
-           const ProcessInfo & proc  = interaction->ProcInfo();
-           // choose ref frame ('Lab' or 'Hit nucleon rest frame')
-           RefFrame_t frame = 
-              (proc.IsCoherent() || proc.IsElectronScattering()) ? 
-              kRfLab : kRfHitNucRest;
-           double E = init.ProbeE(frame);
+     if (spl) {
+           // probe energy at the 'Lab' or 'Hit nucleon rest frame'
+           double E = p4.E();
+           if(!fLabFrame[i]) {
+             TLorentzVector p4n(p4);
+             p4n.Boost(-fHitNucBeta[3*i], -fHitNucBeta[3*i+1], -fHitNucBeta[3*i+2]);
+             E = p4n.E();
+           }
            if(TMath::IsNaN(E)) {
-    		 BLOG("IntSel", pFATAL) << *interaction;
+    		 BLOG("IntSel", pFATAL) << *ilst[i];
     		 BLOG("IntSel", pFATAL) << "E = " << E;
 		 abort();
 	   }
-           const Spline * spl = xssl->GetSpline(xsec_alg,interaction);
            if(spl->ClosestKnotValueIsZero(E,"-")) xsec = 0;
            else xsec = spl->Evaluate(E);
      } else {
-           xsec = xsec_alg->Integral(interaction);
+           fInteraction->Copy(*ilst[i]);
+           fInteraction->InitStatePtr()->SetProbeP4(p4);
+           xsec = fXSecAlg[i]->Integral(fInteraction);
      }
-     TMath::Max(0., xsec);
-/*
-     LOG("IntSel", pNOTICE)
-       << interaction->AsString() 
-       << " --> xsec " << (eval ? "[**interp**]" : "[**calc**]") 
-       << " = " << xsec/cm2 << " cm^2";
-*/
-     xsec_table_printout 
-           << " | " << setfill(' ') << setw(80) << interaction->AsString()
+     xsec = TMath::Max(0., xsec);
+
+     if(print_table) {
+       xsec_table_printout 
+           << " | " << setfill(' ') << setw(80) << ilst[i]->AsString()
            << " | " << setfill(' ') << setw(26) << xsec/(1E-38*cm2)
            << " | " << endl;
+     }
 
-     xseclist[i++] = xsec;
-     delete interaction;
+     xsec_sum    += xsec;
+     fXSecSum[i]  = xsec_sum;
 
   } // loop over interaction that can be generated
 
-  xsec_table_printout
+  if(print_table) {
+    xsec_table_printout
       << " |"  << setfill('-') << setw(112) << "|" << endl;
 
-  LOG("IntSel", pNOTICE)
-    << "\n" << xsec_table_printout.str();
+    LOG("IntSel", pNOTICE)
+      << "\n" << xsec_table_printout.str();
+  }
 
   // select an interaction
 
   LOG("IntSel", pINFO)
             << "Selecting an entry from the Interaction List";
-  double xsec_sum  = 0;
-  for(unsigned int iint = 0; iint < xseclist.size(); iint++) {
-     xsec_sum       += xseclist[iint];
-     xseclist[iint]  = xsec_sum;
 
-     SLOG("IntSel", pINFO)
-             << "Sum{xsec}(0->" << iint << ") = " << xsec_sum;
-  }
   RandomGen * rnd = RandomGen::Instance();
   double R = xsec_sum * rnd->RndISel().Rndm();
 
   LOG("IntSel", pINFO)
       << "Generating Rndm (0. -> max = " << xsec_sum << ") = " << R;
 
-  for(unsigned int iint = 0; iint < xseclist.size(); iint++) {
+  // first entry with Sum{xsec}(0->iint) > R
+  vector<double>::const_iterator xsec_iter =
+        std::upper_bound(fXSecSum.begin(), fXSecSum.end(), R);
+
+  if(xsec_iter != fXSecSum.end()) {
+     unsigned int iint = xsec_iter - fXSecSum.begin();
 
      SLOG("IntSel", pDEBUG)
-               << "Sum{xsec}(0->" << iint <<") = " << xseclist[iint];
+               << "Sum{xsec}(0->" << iint <<") = " << fXSecSum[iint];
 
-     if( R < xseclist[iint] ) {
-       Interaction * selected_interaction = new Interaction (*ilst[iint]);
-       selected_interaction->InitStatePtr()->SetProbeP4(p4);
+     // bootstrap the event record (recycling a previous one, if available)
+     EventRecord * evrec = EventRecordPool::Instance()->Get();
 
-       // set the cross section for the selected interaction (just extract it
-       // from the array of summed xsecs rather than recomputing it)
-       double xsec_pedestal = (iint > 0) ? xseclist[iint-1] : 0.;
-       double xsec = xseclist[iint] - xsec_pedestal;
-       assert(xsec>0);
+     Interaction * selected_interaction = evrec->Summary();
+     selected_interaction->Copy(*ilst[iint]);
+     selected_interaction->InitStatePtr()->SetProbeP4(p4);
 
-       LOG("IntSel", pNOTICE)
-         << "Selected interaction: " << selected_interaction->AsString();
+     // set the cross section for the selected interaction (just extract it
+     // from the array of summed xsecs rather than recomputing it)
+     double xsec_pedestal = (iint > 0) ? fXSecSum[iint-1] : 0.;
+     double xsec = fXSecSum[iint] - xsec_pedestal;
+     assert(xsec>0);
 
-       // bootstrap the event record
-       EventRecord * evrec = new EventRecord;
-       evrec->AttachSummary(selected_interaction);
-       evrec->SetXSec(xsec);
+     LOG("IntSel", pNOTICE)
+       << "Selected interaction: " << selected_interaction->AsString();
 
-       return evrec;
-     }
+     evrec->SetXSec(xsec);
+
+     return evrec;
   }
   LOG("IntSel", pERROR) << "Could not select interaction";
   return 0;
 }
 //___________________________________________________________________________
+void PhysInteractionSelector::BuildSelectionTable(
+                               const InteractionGeneratorMap * igmap) const
+{
+// Collect, once per interaction generator map, everything needed to compute
+// the cross section of each listed interaction at any probe energy
+
+  const InteractionList & ilst = igmap->GetInteractionList();
+  unsigned int nint = ilst.size();
+
+  LOG("IntSel", pINFO) 
+    << "Compiling interaction selection table (" << nint << " interactions)";
+
+  XSecSplineList * xssl = 0;
+  if (fUseSplines) xssl = XSecSplineList::Instance();
+
+  fXSecAlg    .assign(nint,   (const XSecAlgorithmI *) 0);
+  fXSecSpl    .assign(nint,   (const Spline *) 0);
+  fLabFrame   .assign(nint,   false);
+  fHitNucBeta .assign(3*nint, 0.);
+  fXSecSum    .assign(nint,   0.);
+
+  for(unsigned int i = 0; i < nint; i++) {
+     const Interaction * interaction = ilst[i];
+
+     const XSecAlgorithmI * xsec_alg =
+               igmap->FindGenerator(interaction)->CrossSectionAlg();
+     assert(xsec_alg);
+     fXSecAlg[i] = xsec_alg;
+
+     if(fUseSplines && xssl->SplineExists(xsec_alg, interaction)) {
+        fXSecSpl[i] = xssl->GetSpline(xsec_alg, interaction);
+     }
+
+     // choose ref frame ('Lab' or 'Hit nucleon rest frame')
+     const ProcessInfo & proc = interaction->ProcInfo();
+     fLabFrame[i] = (proc.IsCoherent() || proc.IsElectronScattering());
+     if(!fLabFrame[i]) {
+        TLorentzVector * pnuc4 = interaction->InitState().Tgt().HitNucP4Ptr();
+        assert(pnuc4);
+        fHitNucBeta[3*i  ] = pnuc4->Px() / pnuc4->Energy();
+        fHitNucBeta[3*i+1] = pnuc4->Py() / pnuc4->Energy();
+        fHitNucBeta[3*i+2] = pnuc4->Pz() / pnuc4->Energy();
+     }
+  }
+
+  if(!fInteraction) fInteraction = new Interaction;
+
+  fTableIGMapId = igmap->Id();
+  fTableSplGen  = (xssl) ? xssl->Generation() : 0;
+}
+//___________________________________________________________________________
 void PhysInteractionSelector::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -235,5 +302,8 @@ void PhysInteractionSelector::LoadConfigData(void)
   //check whether the user prefers the cross sections to be calculated or
   //evaluated from a spline object constructed at the job initialization
   fUseSplines = fConfig->GetBoolDef("UseStoredXSecs", false);
+
+  // force the selection table to be re-compiled
+  fTableIGMapId = 0;
 }
 //___________________________________________________________________________
@@ -7,6 +7,13 @@
 
          Is a concrete implementation of the InteractionSelectorI interface.
 
+         Each GEVGDriver adopts its own selector. The first time it is asked
+         to select an interaction from a given InteractionGeneratorMap, the
+         selector compiles a flat table with the cross section algorithm,
+         spline and reference frame of every listed interaction. Subsequent
+         selections evaluate the cross sections straight into a reusable
+         cumulative sum buffer and pick an entry with a binary search.
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          STFC, Rutherford Appleton Laboratory
 
@@ -21,10 +28,18 @@
 #ifndef _PHYS_INTERACTION_SELECTOR_H_
 #define _PHYS_INTERACTION_SELECTOR_H_
 
+#include <vector>
+
 #include "EVGCore/InteractionSelectorI.h"
 
+using std::vector;
+
 namespace genie {
 
+class Interaction;
+class Spline;
+class XSecAlgorithmI;
+
 class PhysInteractionSelector : public InteractionSelectorI {
 
 public :
@@ -42,9 +57,20 @@ public :
   void Configure (string param_set);
 
 private:
-  void LoadConfigData (void);
+  void LoadConfigData      (void);
+  void BuildSelectionTable (const InteractionGeneratorMap * igmp) const;
 
   bool fUseSplines;
+
+  // selection table, compiled for the last used InteractionGeneratorMap
+  mutable unsigned long                   fTableIGMapId;  ///< id of the map the table was compiled for (0: none)
+  mutable unsigned int                    fTableSplGen;   ///< XSecSplineList generation the table was compiled for
+  mutable vector<const XSecAlgorithmI *>  fXSecAlg;    ///< xsec algorithm per interaction
+  mutable vector<const Spline *>          fXSecSpl;    ///< xsec spline per interaction (0 if not available)
+  mutable vector<bool>                    fLabFrame;   ///< evaluate spline at the LAB (rather than hit nucleon rest) frame energy?
+  mutable vector<double>                  fHitNucBeta; ///< hit nucleon velocity (3 per interaction)
+  mutable vector<double>                  fXSecSum;    ///< cumulative xsec buffer
+  mutable Interaction *                   fInteraction;///< work interaction for non-spline xsec calculations
 };
 
 }      // genie namespace
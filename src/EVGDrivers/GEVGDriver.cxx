@@ -57,6 +57,7 @@
 #include "Conventions/Units.h"
 #include "EVGDrivers/GEVGDriver.h"
 #include "EVGCore/EventRecord.h"
+#include "EVGCore/EventRecordPool.h"
 #include "EVGCore/EventGeneratorList.h"
 #include "EVGCore/EventGeneratorI.h"
 #include "EVGCore/ToyInteractionSelector.h"
@@ -66,6 +67,7 @@
 #include "EVGCore/InteractionListGeneratorI.h"
 #include "EVGCore/InteractionGeneratorMap.h"
 #include "EVGCore/RunningThreadInfo.h"
+#include "EVGModules/KineGeneratorWithCache.h"
 #include "GHEP/GHepFlags.h"
 #include "Interaction/Interaction.h"
 #include "Messenger/Messenger.h"
@@ -345,7 +347,7 @@ EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
      } else {
        LOG("GEVGDriver", pWARN) 
           << "The generated unphysical event is rejected";
-       delete fCurrentRecord;
+       EventRecordPool::Instance()->Release(fCurrentRecord);
        fCurrentRecord = 0;
        fNRecLevel++; // increase the nested level counter
 
@@ -699,6 +701,77 @@ void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
   fUseSplines = true;
 }
 //___________________________________________________________________________
+bool GEVGDriver::CreateMaxXSecCache(int nknots, double emax)
+{
+// Asks all the kinematics generators (KineGeneratorWithCache) of all loaded
+// event generators to pre-compute the max differential cross sections they
+// need, for all interactions that can be generated, over the energy range
+// used for the cross section splines (see CreateSplines()). 
+// The values are stored in the GENIE cache: If a cache file was opened (see
+// Cache::OpenCacheFile()), they are saved at the end of the job and can be 
+// re-used by event generation jobs opening the same cache file.
+// Returns false if the max xsec spline of any interaction could not be built.
+
+  LOG("GEVGDriver", pNOTICE) << "Creating max differential xsec cache";
+
+  bool success = true;
+
+  EventGeneratorList::const_iterator evgliter; // event generator list iter
+  InteractionList::iterator          intliter; // interaction list iter
+
+  // loop over all EventGenerator objects used in the current job
+  for(evgliter = fEvGenList->begin();
+                               evgliter != fEvGenList->end(); ++evgliter) {
+     // current event generator
+     const EventGeneratorI * evgen = *evgliter;
+
+     // the list of interactions it can generate for the input initial state
+     const InteractionListGeneratorI * ilstgen = evgen->IntListGenerator();
+     InteractionList * ilst = ilstgen->CreateInteractionList(*fInitState);
+     if(!ilst) continue;
+
+     // total cross section algorithm used by the current EventGenerator
+     const XSecAlgorithmI * alg = evgen->CrossSectionAlg();
+
+     // energy range & number of knots as for the cross section splines
+     double Emin = TMath::Max(0.01,evgen->ValidityContext().Emin());
+     double Emax = evgen->ValidityContext().Emax();
+     if(emax>0) Emax = TMath::Min(emax,Emax);
+     int nk = nknots;
+     if(nk<0) {
+       nk = (int) (15 * TMath::Log10(Emax-Emin));
+     }
+     nk = TMath::Max(nk,30);
+
+     // loop over the event generation modules & find the kinematics 
+     // generators caching the max differential cross section
+     const Registry & config = evgen->GetConfig();
+     int nmodules = config.GetInt("NModules");
+     for(int imod = 0; imod < nmodules; imod++) {
+        ostringstream key;
+        key << "Module-" << imod;
+        const KineGeneratorWithCache * kinegen = 
+           dynamic_cast<const KineGeneratorWithCache *> (
+                                         evgen->SubAlg(key.str()));
+        if(!kinegen) continue;
+
+        for(intliter = ilst->begin(); intliter != ilst->end(); ++intliter) {
+           bool ok = kinegen->BuildMaxXSecCache(*intliter, alg, Emin, Emax, nk);
+           if(!ok) {
+             LOG("GEVGDriver", pERROR) 
+               << "Failed to cache the max xsec of " << kinegen->Id().Key()
+               << " for " << (*intliter)->AsString();
+             success = false;
+           }
+        }
+     } // modules
+     delete ilst;
+     ilst = 0;
+  } // loop over event generators
+
+  return success;
+}
+//___________________________________________________________________________
 Range1D_t GEVGDriver::ValidEnergyRange(void) const
 {
 // loops over all loaded event generation threads, queries for the energy
@@ -88,6 +88,10 @@ public :
   // Instruct the driver to create all the splines it needs
   void CreateSplines (int nknots=-1, double emax=-1, bool inLogE=true);
 
+  // Instruct the driver to pre-compute the max differential cross sections
+  // used by the kinematics generators (stored in the GENIE cache)
+  bool CreateMaxXSecCache (int nknots=-1, double emax=-1);
+
   // Methods used for building the 'total' cross section spline
   double XSecSum             (const TLorentzVector & nup4);
   void   CreateXSecSumSpline (int nk, double Emin, double Emax, bool inlogE=true);
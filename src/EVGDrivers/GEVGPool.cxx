@@ -32,7 +32,8 @@ namespace genie {
 }
 //___________________________________________________________________________
 GEVGPool::GEVGPool() :
-map<string, GEVGDriver *>()
+map<string, GEVGDriver *>(),
+fDriverIndex()
 {
 
 }
@@ -49,17 +50,32 @@ GEVGPool::~GEVGPool()
 //___________________________________________________________________________
 GEVGDriver * GEVGPool::FindDriver(const InitialState & init) const
 {
-  string str_init = init.AsString();
+  return this->FindDriver(init.Tgt().Pdg(), init.ProbePdg());
+}
+//___________________________________________________________________________
+GEVGDriver * GEVGPool::FindDriver(int tgt_pdgc, int probe_pdgc) const
+{
+  ULong64_t code = InitialState::Code(tgt_pdgc, probe_pdgc);
 
-  return this->FindDriver(str_init);
+  map<ULong64_t, GEVGDriver *>::const_iterator iiter = fDriverIndex.find(code);
+  if(iiter != fDriverIndex.end()) return iiter->second;
+
+  // first look-up for this initial state: go through the string key
+  // and index the driver (if any) for subsequent look-ups
+  InitialState init(tgt_pdgc, probe_pdgc);
+  GEVGDriver * driver = this->FindDriver(init.AsString());
+  if(driver) {
+    fDriverIndex.insert(map<ULong64_t, GEVGDriver *>::value_type(code,driver));
+  }
+  return driver;
 }
 //___________________________________________________________________________
 GEVGDriver * GEVGPool::FindDriver(string init) const
 {
   GEVGDriver * driver = 0;
 
-  if ( this->count(init) == 1 ) {
-    GEVGPool::const_iterator giter = this->find(init);
+  GEVGPool::const_iterator giter = this->find(init);
+  if ( giter != this->end() ) {
     driver = giter->second;
   } else {
      LOG("GEVGPool", pWARN)
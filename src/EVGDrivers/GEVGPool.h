@@ -5,6 +5,11 @@
 
 \brief   A pool of GEVGDriver objects with an initial state key
 
+         The pool is keyed by InitialState::AsString(). Drivers looked-up
+         by initial state are also indexed by the integer InitialState::Code()
+         so that repeated look-ups (once per flux neutrino and material in
+         the GMCJDriver) need no string building.
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          STFC, Rutherford Appleton Laboratory
 
@@ -23,6 +28,8 @@
 #include <string>
 #include <ostream>
 
+#include <Rtypes.h>
+
 using std::map;
 using std::string;
 using std::ostream;
@@ -39,12 +46,17 @@ public :
   GEVGPool();
   ~GEVGPool();
 
-  GEVGDriver * FindDriver (const InitialState & init) const;
-  GEVGDriver * FindDriver (string init)               const;
+  GEVGDriver * FindDriver (const InitialState & init)    const;
+  GEVGDriver * FindDriver (int tgt_pdgc, int probe_pdgc) const;
+  GEVGDriver * FindDriver (string init)                  const;
 
   void Print (ostream & stream) const;
 
   friend ostream & operator << (ostream & stream, const GEVGPool & pool);
+
+private:
+
+  mutable map<ULong64_t, GEVGDriver *> fDriverIndex; //! init state code -> driver
 };
 
 }      // genie namespace
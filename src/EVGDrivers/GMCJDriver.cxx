@@ -100,10 +100,17 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdio>
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+
+#include <unistd.h>
 
 #include <TVector3.h>
 #include <TSystem.h>
 #include <TStopwatch.h>
+#include <TChain.h>
 
 #include "Algorithm/AlgConfigPool.h"
 #include "Conventions/GBuild.h"
@@ -116,6 +123,7 @@
 #include "EVGDrivers/GEVGPool.h"
 #include "EVGDrivers/GFluxI.h"
 #include "EVGDrivers/GeomAnalyzerI.h"
+#include "EVGDrivers/GMCJWorkerPool.h"
 #include "GHEP/GHepFlags.h"
 #include "GHEP/GHepParticle.h"
 #include "Interaction/InitialState.h"
@@ -127,6 +135,9 @@
 #include "Utils/XSecSplineList.h"
 #include "Conventions/Constants.h"
 
+using std::ostringstream;
+using std::pair;
+
 using namespace genie;
 using namespace genie::constants;
 
@@ -242,18 +253,20 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
 // (such as neutrino type) and save the interaction probability in a tree 
 // relating flux index (entry number in input flux tree) to interaction 
 // probability. If a pre-generated flux interaction probability tree has 
-// already been loaded then just returns true. Also save tree to a TFile
+// already been loaded then just returns true, unless it was loaded for
+// extension (see LoadFluxProbabilities) in which case only the probabilities
+// missing from the loaded tree are calculated. Also save tree to a TFile
 // for use in later jobs if flag is set 
 //
   bool success = true;
  
-  bool save_to_file = fFluxIntProbFile == 0 && fFluxIntFileName.size()>0;
+  bool save_to_file = false;
 
   // Clear map storing sum(fBrFluxWeight*fBrFluxIntProb) for each neutrino pdg
   fSumFluxIntProbs.clear();
 
   // check if already loaded flux interaction probs using LoadFluxProbTree
-  if(fFluxIntTree){
+  if(fFluxIntTree && !fExtendFluxIntProbs){
     LOG("GMCJDriver", pNOTICE) << 
          "Skipping pre-generation of flux interaction probabilities - "<<
          "using pre-generated file";
@@ -262,6 +275,30 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
   // otherwise create them on the fly now 
   else {
 
+    // if extending a loaded tree, keep note of the flux entries it already
+    // covers and release the input file (its entries are merged in later)
+    string extend_file = "";
+    vector<int> skip;
+    if(fFluxIntTree){
+      extend_file = fFluxIntProbFile->GetName();
+      for(int i = 0; i< fFluxIntTree->GetEntries(); i++){
+        fFluxIntTree->GetEntry(i);
+        skip.push_back(fBrFluxIndex);
+      }
+      sort(skip.begin(), skip.end());
+      LOG("GMCJDriver", pNOTICE) 
+         << "Extending the " << skip.size() 
+         << " pre-generated flux interaction probabilities in file: " 
+         << extend_file;
+      fFluxIntProbFile->Close();
+      delete fFluxIntProbFile;
+      fFluxIntProbFile = 0;
+      fFluxIntTree = 0;
+      fExtendFluxIntProbs = false;
+    }
+
+    save_to_file = fFluxIntFileName.size()>0;
+
     if(save_to_file){
       fFluxIntProbFile = new TFile(fFluxIntFileName.c_str(), "CREATE");
       if(fFluxIntProbFile->IsZombie()){
@@ -271,64 +308,18 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
     } 
   
     // Create the tree to store flux probs
-    fFluxIntTree = new TTree(fFluxIntTreeName.c_str(), 
-                         "Tree storing pre-calculated flux interaction probs"); 
-    fFluxIntTree->Branch("FluxIndex", &fBrFluxIndex, "FluxIndex/I");
-    fFluxIntTree->Branch("FluxIntProb", &fBrFluxIntProb, "FluxIntProb/D");
-    fFluxIntTree->Branch("FluxEnu", &fBrFluxEnu, "FluxEnu/D"); 
-    fFluxIntTree->Branch("FluxWeight", &fBrFluxWeight, "FluxWeight/D"); 
-    fFluxIntTree->Branch("FluxPDG", &fBrFluxPDG, "FluxPDG/I"); 
+    fFluxIntTree = this->CreateFluxProbTree();
     // Associate to file otherwise get std::bad_alloc when writing large trees 
     if(save_to_file) fFluxIntTree->SetDirectory(fFluxIntProbFile); 
- 
-    fFluxDriver->GenerateWeighted(true);
-  
-    fGlobPmax = 1.0; // Force ComputeInteractionProbabilities to return absolute value
-  
-    // Loop over flux entries and calculate interaction probabilities
+
     TStopwatch stopwatch; 
     stopwatch.Start();
-    long int first_index = -1;
-    bool first_loop = true;
-    // loop until at end of flux ntuple
-    while(fFluxDriver->End() == false){ 
-
-      // get the next flux neutrino
-      bool gotnext = fFluxDriver->GenerateNext(); 
-      if(!gotnext){
-        LOG("GMCJDriver", pWARN) << "*** Couldn't generate next flux ray! ";
-        continue;
-      }
-
-      // stop if completed a full cycle (this check is necessary as fluxdriver
-      // may be set to loop over more than one cycle before reaching end) 
-      bool already_been_here = first_loop ? false : first_index == fFluxDriver->Index();
-      if(already_been_here) break; 
-   
-      // compute the path lengths for current flux neutrino 
-      if(this->ComputePathLengths() == false){ success = false; break;}
-  
-      // compute and store the interaction probability 
-      double psum = this->ComputeInteractionProbabilities(false /*Based on actual PLs*/);
-      assert(psum+controls::kASmallNum > 0.);
-      fBrFluxIntProb = psum;
-      fBrFluxIndex   = fFluxDriver->Index();
-      fBrFluxEnu     = fFluxDriver->Momentum().E();
-      fBrFluxWeight  = fFluxDriver->Weight();
-      fBrFluxPDG     = fFluxDriver->PdgCode();
-      fFluxIntTree->Fill();
-
-      // store the first index so know when have cycled exactly once
-      if(first_loop){
-        first_index = fFluxDriver->Index();
-        first_loop = false;
-      }
-    } // flux loop
+    success = this->CalcFluxProbabilities(extend_file, skip);
     stopwatch.Stop();            
     LOG("GMCJDriver", pNOTICE)
                     << "Finished pre-calculating flux interaction probabilities. "
-                    << "Total CPU time to process "<< fFluxIntTree->GetEntries()
-                    << " entries: "<< stopwatch.CpuTime();
+                    << "Total time to collect "<< fFluxIntTree->GetEntries()
+                    << " entries: "<< stopwatch.RealTime();
 
     // reset the flux driver so can be used at next stage. N.B. This 
     // should also reset flux driver to throw de-weighted flux neutrinos
@@ -387,13 +378,18 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
   return success;
 }
 //___________________________________________________________________________
-bool GMCJDriver::LoadFluxProbabilities(string filename)
+bool GMCJDriver::LoadFluxProbabilities(string filename, bool extend)
 {
 // Load a pre-generated set of flux interaction probabilities from an external
 // file. This is recommended when using large flux files (>100k entries) as  
 // for these the time to calculate the interaction probabilities can exceed 
 // ~20 minutes. After loading the input tree we call PreCalcFluxProbabilities
-// to check that has successfully loaded
+// to check that has successfully loaded.
+// If extend is set (eg because more files were added to the flux driver since
+// the input file was generated) the interaction probabilities of all flux 
+// entries missing from the input file are calculated and merged with the
+// loaded ones. Use SaveFluxProbabilities to keep the extended set (the output
+// file must differ from the input one).
 //
   if(fFluxIntProbFile){
     LOG("GMCJDriver", pWARN) 
@@ -413,6 +409,7 @@ bool GMCJDriver::LoadFluxProbabilities(string filename)
         fFluxIntTree->SetBranchAddress("FluxWeight", &fBrFluxWeight) >= 0 &&
         fFluxIntTree->SetBranchAddress("FluxEnu", &fBrFluxEnu) >= 0; 
       if(set_addresses){ 
+        fExtendFluxIntProbs = extend;
         // Finally check that can use them
         if(this->PreCalcFluxProbabilities()) {
           LOG("GMCJDriver", pNOTICE) 
@@ -443,6 +440,181 @@ void GMCJDriver::SaveFluxProbabilities(string outfilename)
   fFluxIntFileName = outfilename;
 }
 //___________________________________________________________________________
+void GMCJDriver::SetNFluxProbWorkers(int nworkers)
+{
+// Set the number of worker processes sharing the pre-calculation of the
+// flux interaction probabilities (see CalcFluxProbabilities)
+//
+  fNFluxProbWorkers = TMath::Max(1, nworkers);
+}
+//___________________________________________________________________________
+TTree * GMCJDriver::CreateFluxProbTree(void)
+{
+  TTree * tree = new TTree(fFluxIntTreeName.c_str(), 
+                       "Tree storing pre-calculated flux interaction probs"); 
+  tree->Branch("FluxIndex", &fBrFluxIndex, "FluxIndex/I");
+  tree->Branch("FluxIntProb", &fBrFluxIntProb, "FluxIntProb/D");
+  tree->Branch("FluxEnu", &fBrFluxEnu, "FluxEnu/D"); 
+  tree->Branch("FluxWeight", &fBrFluxWeight, "FluxWeight/D"); 
+  tree->Branch("FluxPDG", &fBrFluxPDG, "FluxPDG/I"); 
+  return tree;
+}
+//___________________________________________________________________________
+bool GMCJDriver::CalcFluxProbabilities(
+    string extend_file, const vector<int> & skip)
+{
+// Calculate the interaction probabilities of all flux entries not in the 
+// (sorted) skip list and add them to fFluxIntTree.
+// With N>1 workers the flux entries are shared between N forked processes 
+// (worker i takes the flux indices with index%N == i). Each process owns a 
+// copy of the geometry and its navigator, so the path lengths are computed
+// independently. Each worker writes its output to a temporary file. The 
+// worker outputs and the extended file (if any) are then merged into 
+// fFluxIntTree ordered by flux index.
+//
+  fFluxDriver->GenerateWeighted(true);
+  
+  fGlobPmax = 1.0; // Force ComputeInteractionProbabilities to return absolute value
+
+  GMCJWorkerPool workers(fNFluxProbWorkers);
+
+  // single process & nothing to merge: fill fFluxIntTree directly
+  if(!workers.IsParallel() && extend_file.size() == 0) {
+    return this->FillFluxProbabilities(fFluxIntTree, 0, 1, skip);
+  }
+
+  ostringstream prefix;
+  prefix << fFluxIntTreeName << "." << gSystem->GetPid();
+
+  int iworker = workers.Fork();
+  if(iworker >= 0) {
+    string filename = 
+       workers.WorkerFilenamePrefix(prefix.str(), iworker) + ".root";
+    TFile * file = new TFile(filename.c_str(), "RECREATE");
+    TTree * tree = this->CreateFluxProbTree();
+    bool ok = this->FillFluxProbabilities(
+                       tree, iworker, workers.NWorkers(), skip);
+    // a worker file without a tree flags a failed calculation
+    if(ok) tree->Write();
+    file->Close();
+    delete file;
+    if(workers.IsParallel()) {
+      // leave without running the exit handlers (they would act on the
+      // files the worker has inherited from the master process)
+      std::cout.flush();
+      std::cerr.flush();
+      fflush(0);
+      _exit(0);
+    }
+  }
+
+  // merge
+  bool success = true;
+  TChain * chain = new TChain(fFluxIntTreeName.c_str());
+  if(extend_file.size() > 0) {
+    success = (chain->Add(extend_file.c_str(), 0) > 0);
+  }
+  for(int iw = 0; iw < workers.NWorkers(); iw++) {
+    string filename = workers.WorkerFilenamePrefix(prefix.str(), iw) + ".root";
+    if(chain->Add(filename.c_str(), 0) == 0) {
+      LOG("GMCJDriver", pERROR) 
+        << "No flux interaction probabilities from worker " << iw;
+      success = false;
+    }
+  }
+  if(success && chain->GetEntries() > 0) {
+    chain->SetBranchAddress("FluxIndex",   &fBrFluxIndex);
+    chain->SetBranchAddress("FluxIntProb", &fBrFluxIntProb);
+    chain->SetBranchAddress("FluxEnu",     &fBrFluxEnu);
+    chain->SetBranchAddress("FluxWeight",  &fBrFluxWeight);
+    chain->SetBranchAddress("FluxPDG",     &fBrFluxPDG);
+    // order the entries by flux index (the worker outputs interleave them,
+    // so a TChainIndex can not be built)
+    Long64_t nentries = chain->GetEntries();
+    vector< pair<int, Long64_t> > sorted;
+    sorted.reserve(nentries);
+    for(Long64_t i = 0; i < nentries; i++) {
+      chain->GetEntry(i);
+      sorted.push_back(pair<int, Long64_t>(fBrFluxIndex, i));
+    }
+    std::sort(sorted.begin(), sorted.end());
+    for(Long64_t i = 0; i < nentries; i++) {
+      chain->GetEntry(sorted[i].second);
+      fFluxIntTree->Fill();
+    }
+  }
+  delete chain;
+
+  for(int iw = 0; iw < workers.NWorkers(); iw++) {
+    string filename = workers.WorkerFilenamePrefix(prefix.str(), iw) + ".root";
+    gSystem->Unlink(filename.c_str());
+  }
+
+  return success;
+}
+//___________________________________________________________________________
+bool GMCJDriver::FillFluxProbabilities(
+    TTree * tree, int iworker, int nworkers, const vector<int> & skip)
+{
+// Loop once over the flux entries and fill the input tree with the 
+// interaction probabilities of the entries assigned to the current worker
+// and not in the (sorted) skip list.
+//
+  bool success = true;
+
+  // Loop over flux entries and calculate interaction probabilities
+  TStopwatch stopwatch; 
+  stopwatch.Start();
+  long int first_index = -1;
+  bool first_loop = true;
+  // loop until at end of flux ntuple
+  while(fFluxDriver->End() == false){ 
+
+    // get the next flux neutrino
+    bool gotnext = fFluxDriver->GenerateNext(); 
+    if(!gotnext){
+      LOG("GMCJDriver", pWARN) << "*** Couldn't generate next flux ray! ";
+      continue;
+    }
+
+    // stop if completed a full cycle (this check is necessary as fluxdriver
+    // may be set to loop over more than one cycle before reaching end) 
+    bool already_been_here = first_loop ? false : first_index == fFluxDriver->Index();
+    if(already_been_here) break; 
+
+    // store the first index so know when have cycled exactly once
+    if(first_loop){
+      first_index = fFluxDriver->Index();
+      first_loop = false;
+    }
+
+    // skip entries taken by other workers or already calculated
+    long int flux_index = fFluxDriver->Index();
+    if(nworkers > 1 && flux_index % nworkers != iworker) continue;
+    if(binary_search(skip.begin(), skip.end(), (int)flux_index)) continue;
+ 
+    // compute the path lengths for current flux neutrino 
+    if(this->ComputePathLengths() == false){ success = false; break;}
+
+    // compute and store the interaction probability 
+    double psum = this->ComputeInteractionProbabilities(false /*Based on actual PLs*/);
+    assert(psum+controls::kASmallNum > 0.);
+    fBrFluxIntProb = psum;
+    fBrFluxIndex   = flux_index;
+    fBrFluxEnu     = fFluxDriver->Momentum().E();
+    fBrFluxWeight  = fFluxDriver->Weight();
+    fBrFluxPDG     = fFluxDriver->PdgCode();
+    tree->Fill();
+  } // flux loop
+  stopwatch.Stop();            
+  LOG("GMCJDriver", pNOTICE)
+                  << "Finished calculating flux interaction probabilities. "
+                  << "Total CPU time to process "<< tree->GetEntries()
+                  << " entries: "<< stopwatch.CpuTime();
+
+  return success;
+}
+//___________________________________________________________________________
 void GMCJDriver::Configure(bool calc_prob_scales)
 {
   LOG("GMCJDriver", pNOTICE)
@@ -530,6 +702,8 @@ void GMCJDriver::InitJob(void)
   fBrFluxWeight       = -1.;
   fBrFluxPDG          = 0;
   fSumFluxIntProbs.clear();
+  fNFluxProbWorkers   = 1;
+  fExtendFluxIntProbs = false;
 
   // Throw as many flux neutrinos as necessary till one has interacted
   // so that GenerateEvent() never  returns NULL (except when in error)
@@ -1134,9 +1308,10 @@ double GMCJDriver::ComputeInteractionProbabilities(bool use_max_path_length)
      double probn = 0.;                       // normalized interaction probability
 
      // find the GEVGDriver object that is handling the current init state
-     InitialState init_state(mpdg, nupdg);
-     GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
+     // (integer-keyed look-up: this runs for every flux neutrino & material)
+     GEVGDriver * evgdriver = fGPool->FindDriver(mpdg, nupdg);
      if(!evgdriver) {
+       InitialState init_state(mpdg, nupdg);
        LOG("GMCJDriver", pFATAL)
         << "\n * The MC Job driver isn't properly configured!"
         << "\n * No event generation driver could be found for init state: " 
@@ -1147,6 +1322,7 @@ double GMCJDriver::ComputeInteractionProbabilities(bool use_max_path_length)
      if(pl>0.) {
         const Spline * totxsecspl = evgdriver->XSecSumSpline();
         if(!totxsecspl) {
+            InitialState init_state(mpdg, nupdg);
             LOG("GMCJDriver", pFATAL)
               << "\n * The MC Job driver isn't properly configured!"
               << "\n * Couldn't retrieve total cross section spline for init state: " 
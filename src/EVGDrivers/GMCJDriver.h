@@ -23,6 +23,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 #include <TH1D.h>
 #include <TLorentzVector.h>
@@ -35,6 +36,7 @@
 
 using std::string;
 using std::map;
+using std::vector;
 
 namespace genie {
 
@@ -61,8 +63,9 @@ public :
   void ForceSingleProbScale        (void);
   void PreSelectEvents             (bool preselect = true);
   bool PreCalcFluxProbabilities    (void);
-  bool LoadFluxProbabilities       (string filename);
+  bool LoadFluxProbabilities       (string filename, bool extend = false);
   void SaveFluxProbabilities       (string outfilename);
+  void SetNFluxProbWorkers         (int nworkers);
   void Configure                   (bool calc_prob_scales = true);
 
   // generate single neutrino event for input flux & geometry
@@ -101,6 +104,9 @@ private:
   void          ComputeEventProbability         (void);
   double        InteractionProbability          (double xsec, double pl, int A);
   double        PreGenFluxInteractionProbability(void);
+  TTree *       CreateFluxProbTree              (void);
+  bool          CalcFluxProbabilities           (string extend_file, const vector<int> & skip);
+  bool          FillFluxProbabilities           (TTree * tree, int iworker, int nworkers, const vector<int> & skip);
 
   // private data members:
   GEVGPool *      fGPool;              ///< A pool of GEVGDrivers properly configured event generation drivers / one per init state
@@ -137,6 +143,8 @@ private:
   string          fFluxIntFileName;    ///< whether to save pre-generated flux tree for use in later jobs
   string          fFluxIntTreeName;    ///< name for tree holding flux probabilities 
   map<int, double> fSumFluxIntProbs;   ///< map where the key is flux pdg code and the value is sum of fBrFluxWeight * fBrFluxIntProb for all these flux neutrinos 
+  int             fNFluxProbWorkers;   ///< [config] number of worker processes used for pre-calculating the flux interaction probabilities
+  bool            fExtendFluxIntProbs; ///< [config] calculate the flux interaction probabilities missing from the loaded file?
 };
 
 }      // genie namespace
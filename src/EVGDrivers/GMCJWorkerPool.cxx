@@ -0,0 +1,175 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+         Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+         STFC, Rutherford Appleton Laboratory
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <TMath.h>
+
+#include "EVGDrivers/GMCJWorkerPool.h"
+#include "Messenger/Messenger.h"
+#include "Numerical/RandomGen.h"
+#include "Utils/Cache.h"
+
+using std::ostringstream;
+
+using namespace genie;
+
+//____________________________________________________________________________
+GMCJWorkerPool::GMCJWorkerPool(int nworkers) :
+fNWorkers(TMath::Max(1,nworkers)),
+fWorkerId(0)
+{
+
+}
+//____________________________________________________________________________
+GMCJWorkerPool::~GMCJWorkerPool()
+{
+
+}
+//____________________________________________________________________________
+int GMCJWorkerPool::Fork(void)
+{
+  fWorkerId = 0;
+  fPids.clear();
+
+  if(!this->IsParallel()) return fWorkerId;
+
+  LOG("GMCJWorkerPool", pNOTICE)
+    << "Forking " << fNWorkers << " event generation workers";
+
+  long int base_seed = RandomGen::Instance()->GetJobSeed();
+
+  // flush all buffered output so that it is not replicated by each worker
+  std::cout.flush();
+  std::cerr.flush();
+  fflush(0);
+
+  for(int iw = 0; iw < fNWorkers; iw++) {
+    pid_t pid = fork();
+    if(pid < 0) {
+      LOG("GMCJWorkerPool", pFATAL)
+        << "Could not fork event generation worker " << iw;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    if(pid == 0) {
+      this->InitWorker(iw, base_seed);
+      LOG("GMCJWorkerPool", pNOTICE)
+        << "Worker " << fWorkerId << " (pid: " << getpid() << ") started";
+      return fWorkerId;
+    }
+    fPids.push_back(pid);
+  }
+
+  // master: block until all the workers are done
+  fWorkerId = -1;
+  this->WaitForWorkers();
+
+  return fWorkerId;
+}
+//____________________________________________________________________________
+int GMCJWorkerPool::FirstEvent(int nev) const
+{
+  if(fWorkerId <= 0) return 0;
+
+  int nblock = nev / fNWorkers;
+  int nextra = nev % fNWorkers;
+
+  return fWorkerId * nblock + TMath::Min(fWorkerId, nextra);
+}
+//____________________________________________________________________________
+int GMCJWorkerPool::NEvents(int nev) const
+{
+  if(fWorkerId < 0)       return 0;
+  if(!this->IsParallel()) return nev;
+
+  int nblock = nev / fNWorkers;
+  int nextra = nev % fNWorkers;
+
+  return nblock + ((fWorkerId < nextra) ? 1 : 0);
+}
+//____________________________________________________________________________
+long int GMCJWorkerPool::WorkerSeed(long int base_seed, int iworker) const
+{
+  if(!this->IsParallel()) return base_seed;
+
+  return base_seed + iworker;
+}
+//____________________________________________________________________________
+string GMCJWorkerPool::WorkerFilenamePrefix(string prefix, int iworker) const
+{
+  if(!this->IsParallel()) return prefix;
+
+  ostringstream name;
+  name << prefix << ".w" << iworker;
+  return name.str();
+}
+//____________________________________________________________________________
+void GMCJWorkerPool::InitWorker(int iworker, long int base_seed)
+{
+// Post-fork hook, run in each worker
+
+  fWorkerId = iworker;
+  fPids.clear();
+
+  // detach the writable resources owned by the parent process
+  Cache::Instance()->DetachCacheFile();
+
+  // own random number sequence. The job seed is kept for keying events
+  // (RandomGen::SetEventKey()) so that events do not depend on the worker
+  // generating them.
+  RandomGen::Instance()->SetStreamSeed(this->WorkerSeed(base_seed, iworker));
+}
+//____________________________________________________________________________
+void GMCJWorkerPool::WaitForWorkers(void)
+{
+  bool ok = true;
+
+  for(unsigned int iw = 0; iw < fPids.size(); iw++) {
+    int status = 0;
+    if(waitpid(fPids[iw], &status, 0) < 0) {
+      LOG("GMCJWorkerPool", pERROR)
+        << "Lost track of worker " << iw << " (pid: " << fPids[iw] << ")";
+      ok = false;
+      continue;
+    }
+    bool worker_ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    if(!worker_ok) {
+      LOG("GMCJWorkerPool", pERROR)
+        << "Worker " << iw << " (pid: " << fPids[iw] << ") failed";
+      ok = false;
+      continue;
+    }
+    LOG("GMCJWorkerPool", pNOTICE) << "Worker " << iw << " finished";
+  }
+  fPids.clear();
+
+  if(!ok) {
+    LOG("GMCJWorkerPool", pFATAL)
+      << "At least one event generation worker failed. Exiting!";
+    gAbortingInErr = true;
+    exit(1);
+  }
+}
+//____________________________________________________________________________
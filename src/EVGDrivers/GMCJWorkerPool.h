@@ -0,0 +1,100 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::GMCJWorkerPool
+
+\brief   Runs an already configured MC job in N parallel worker processes.
+
+         All GENIE event generation singletons (RandomGen, XSecSplineList,
+         AlgConfigPool, Cache, PDGLibrary, Messenger, ...) hold mutable state
+         so the event generation chain can not be run on threads. Instead,
+         once the job driver has been configured (splines loaded or built,
+         geometry loaded, GEVGPool populated), the pool forks N workers.
+         Each worker inherits a private copy-on-write image of the parent,
+         so it owns its GEVGPool, flux driver cursor and random number
+         generator, while the bulky read-only state (splines, geometry,
+         configuration) stays physically shared between all workers.
+
+         Each worker is given:
+         - a deterministic random number seed (base seed + worker id) for
+           its random number streams. The job seed is kept for re-seeding
+           the streams at each event (see RandomGen::SetEventKey()), so
+           keyed events are identical whatever the number of workers,
+         - a contiguous block of event numbers, so that the event numbering
+           of the merged output does not depend on the number of workers.
+
+         Right after the fork, each worker detaches the writable resources
+         owned by the parent process (the GENIE cache file is reopened
+         read-only, see Cache::DetachCacheFile()), so that nothing they
+         share is written or closed at the worker exit.
+
+         The master process waits for all workers to terminate. It is then
+         up to the client to merge the per-worker outputs (see
+         NtpWriter::AddEventRecords()).
+
+         Flux drivers cycling over beam simulation ntuples replay the same
+         entries in every worker. The client is responsible for assigning
+         them disjoint entry ranges in that case.
+
+\author  The GENIE Collaboration
+         Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+         STFC, Rutherford Appleton Laboratory
+
+\created October 16, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _G_MC_JOB_WORKER_POOL_H_
+#define _G_MC_JOB_WORKER_POOL_H_
+
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+namespace genie {
+
+class GMCJWorkerPool {
+
+public :
+  GMCJWorkerPool(int nworkers = 1);
+ ~GMCJWorkerPool();
+
+  //! Fork the workers. Returns the worker id (in [0,N)) in each worker,
+  //! and -1 in the master process once all workers have terminated.
+  //! With a single worker no process is forked and 0 is returned.
+  int  Fork (void);
+
+  bool IsMaster   (void) const { return fWorkerId < 0;        }
+  bool IsParallel (void) const { return fNWorkers > 1;        }
+  int  WorkerId   (void) const { return fWorkerId;            }
+  int  NWorkers   (void) const { return fNWorkers;            }
+
+  //! Event number block [first, first+n) assigned to the current worker
+  int  FirstEvent (int nev) const;
+  int  NEvents    (int nev) const;
+
+  //! Random number seed used by the given worker
+  long int WorkerSeed (long int base_seed, int iworker) const;
+
+  //! Name of the per-worker output file derived from the input prefix
+  string WorkerFilenamePrefix (string prefix, int iworker) const;
+
+private:
+
+  void InitWorker     (int iworker, long int base_seed);
+  void WaitForWorkers (void);
+
+  int         fNWorkers;  ///< number of worker processes
+  int         fWorkerId;  ///< worker id or -1 for the master process
+  vector<int> fPids;      ///< [master only] process ids of the workers
+};
+
+}      // genie namespace
+
+#endif // _G_MC_JOB_WORKER_POOL_H_
@@ -26,12 +26,16 @@
 //#include <TSQLResult.h>
 //#include <TSQLRow.h>
 #include <TMath.h>
+#include <TMD5.h>
 
 #include "EVGCore/EVGThreadException.h"
 #include "EVGModules/KineGeneratorWithCache.h"
 #include "GHEP/GHepRecord.h"
 #include "GHEP/GHepFlags.h"
+#include "Interaction/Interaction.h"
 #include "Messenger/Messenger.h"
+#include "Registry/Registry.h"
+#include "Registry/RegistryItemI.h"
 #include "Utils/Cache.h"
 #include "Utils/CacheBranchFx.h"
 #include "Utils/MathUtils.h"
@@ -41,6 +45,9 @@ using std::map;
 
 using namespace genie;
 
+// min number of cached max xsec values for building the max xsec spline
+static const unsigned int kNMaxXSecSplineMin = 41;
+
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache() :
 EventRecordVisitorI()
@@ -201,7 +208,7 @@ void KineGeneratorWithCache::CacheMaxXSec(
   if(max_xsec>0) cb->AddValues(E,max_xsec);
 
   if(! cb->Spl() ) {
-    if( cb->Map().size() > 40 ) cb->CreateSpline();
+    if( cb->Map().size() >= kNMaxXSecSplineMin ) cb->CreateSpline();
   }
 
   if( cb->Spl() ) {
@@ -230,10 +237,12 @@ CacheBranchFx * KineGeneratorWithCache::AccessCacheBranch(
 
   Cache * cache = Cache::Instance();
 
-  // build the cache branch key as: namespace::algorithm/config/interaction
+  // build the cache branch key as: 
+  // namespace::algorithm/config/interaction/configuration-tag
   string algkey = this->Id().Key();
   string intkey = interaction->AsString();
-  string key    = cache->CacheBranchKey(algkey, intkey);
+  string cfgkey = this->CacheConfigKey();
+  string key    = cache->CacheBranchKey(algkey, intkey, cfgkey);
 
   CacheBranchFx * cache_branch =
               dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
@@ -250,6 +259,162 @@ CacheBranchFx * KineGeneratorWithCache::AccessCacheBranch(
   return cache_branch;
 }
 //___________________________________________________________________________
+void KineGeneratorWithCache::Configure(const Registry & config)
+{
+  Algorithm::Configure(config);
+  fCacheConfigKeys.clear();
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::Configure(string config)
+{
+  Algorithm::Configure(config);
+  fCacheConfigKeys.clear();
+}
+//___________________________________________________________________________
+string KineGeneratorWithCache::CacheConfigKey(void) const
+{
+// Returns a tag identifying the configuration of this algorithm and of the
+// cross section model in use (including all their sub-algorithms). Since it
+// is part of the cache branch key, max xsec values cached by an earlier job 
+// with a different physics configuration are never picked up from a cache
+// file.
+
+  string xseckey = (fXSecModel) ? fXSecModel->Id().Key() : "";
+
+  map<string,string>::const_iterator iter = fCacheConfigKeys.find(xseckey);
+  if(iter != fCacheConfigKeys.end()) return iter->second;
+
+  ostringstream config;
+  map<string,bool> printed;
+  this->PrintConfigTree(this, config, printed);
+  if(fXSecModel) this->PrintConfigTree(fXSecModel, config, printed);
+
+  string cfgstr = config.str();
+  TMD5 md5;
+  md5.Update( (const UChar_t *) cfgstr.c_str(), cfgstr.size() );
+  md5.Final();
+
+  ostringstream tag;
+  tag << xseckey << "#" << md5.AsString();
+
+  fCacheConfigKeys.insert(map<string,string>::value_type(xseckey,tag.str()));
+
+  LOG("Kinematics", pINFO) 
+     << "Max xsec cache configuration tag: " << tag.str();
+
+  return tag.str();
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::PrintConfigTree(
+   const Algorithm * alg, ostream & stream, map<string,bool> & printed) const
+{
+// Prints the configuration of the input algorithm and (recursively) of all
+// its sub-algorithms. Each algorithm is printed only once.
+
+  if(!alg) return;
+  if(printed.find(alg->Id().Key()) != printed.end()) return;
+  printed[alg->Id().Key()] = true;
+
+  stream << "[" << alg->Id().Key() << "]";
+
+  const RgIMap & items = alg->GetConfig().GetItemMap();
+  RgIMapConstIter iter = items.begin();
+  for( ; iter != items.end(); ++iter) {
+    RegistryItemI * item = iter->second;
+    if(!item) continue;
+    stream << iter->first << "=";
+    item->Print(stream);
+    stream << ";";
+    if(item->TypeInfo() == kRgAlg) {
+      this->PrintConfigTree(alg->SubAlg(iter->first), stream, printed);
+    }
+  }
+}
+//___________________________________________________________________________
+bool KineGeneratorWithCache::BuildMaxXSecCache(
+    const Interaction * interaction, const XSecAlgorithmI * xsec_model,
+    double Emin, double Emax, int nknots) const
+{
+// Computes the max{dxsec/dK} for the input interaction & cross section model
+// at nknots (log-spaced) energies in [Emin,Emax] and builds the max xsec
+// spline used for event generation in one go. This can be used for building
+// a cache file offline (see gmkspl), so that event generation jobs loading 
+// it do not need to scan the phase space at each new energy till enough 
+// points are cached.
+// The grid starts at the first energy where the max xsec can be cached (above
+// threshold and above fEMin) and has at least as many knots as needed for
+// building the spline at event generation (see CacheMaxXSec()).
+// Returns false if the spline could not be built.
+
+  if(!interaction || !xsec_model || nknots < 2 || Emax <= Emin) return false;
+
+  fXSecModel = xsec_model;
+
+  Interaction in(*interaction);
+  in.SetBit(kISkipProcessChk);
+
+  CacheBranchFx * cb = this->AccessCacheBranch(&in);
+  if(cb->Spl()) {
+    LOG("Kinematics", pINFO) 
+       << "Max xsec already cached for " << in.AsString();
+    return true;
+  }
+
+  double logEmin = TMath::Log(Emin);
+  double logEmax = TMath::Log(Emax);
+  double dlogE   = (logEmax - logEmin) / (nknots-1);
+
+  // find the first knot where the max xsec can be cached
+  int ifirst = -1;
+  for(int i = 0; i < nknots; i++) {
+    in.InitStatePtr()->SetProbeE(TMath::Exp(logEmin + i*dlogE));
+    in.KinePtr()->Reset();
+    // explicit calculation is forced below fEMin anyway
+    if(this->Energy(&in) < fEMin) continue;
+    if(!in.PhaseSpace().IsAboveThreshold()) continue;
+    ifirst = i;
+    break;
+  }
+  if(ifirst < 0) {
+    LOG("Kinematics", pINFO) 
+       << "No max xsec to cache in [" << Emin << ", " << Emax 
+       << "] GeV for " << in.AsString();
+    return true;
+  }
+
+  // re-grid the usable energy range
+  int nk = TMath::Max(nknots - ifirst, (int) kNMaxXSecSplineMin);
+  logEmin = logEmin + ifirst*dlogE;
+  dlogE   = (logEmax - logEmin) / (nk-1);
+
+  LOG("Kinematics", pNOTICE) 
+     << "Caching max{dxsec/dK} for " << in.AsString() << " at " << nk
+     << " energies in [" << TMath::Exp(logEmin) << ", " << Emax << "] GeV";
+
+  for(int i = 0; i < nk; i++) {
+    in.InitStatePtr()->SetProbeE(TMath::Exp(logEmin + i*dlogE));
+    in.KinePtr()->Reset();
+    double E = this->Energy(&in);
+    if(E < fEMin) continue;
+    if(!in.PhaseSpace().IsAboveThreshold()) continue;
+    double xsec_max = this->ComputeMaxXSec(&in);
+    if(xsec_max > 0) cb->AddValues(E, xsec_max);
+  }
+
+  // same condition as at event generation, so that a cached grid is always
+  // used through its spline
+  if(cb->Map().size() < kNMaxXSecSplineMin) {
+    LOG("Kinematics", pERROR) 
+       << "Only " << cb->Map().size() << " max xsec values could be cached "
+       << "for " << in.AsString() << " (at least " << kNMaxXSecSplineMin
+       << " are needed for building the max xsec spline)";
+    return false;
+  }
+  cb->CreateSpline();
+
+  return true;
+}
+//___________________________________________________________________________
 void KineGeneratorWithCache::AssertXSecLimits(
          const Interaction * interaction, double xsec, double xsec_max) const
 {
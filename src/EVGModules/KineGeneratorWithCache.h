@@ -28,12 +28,16 @@
 #define _KINE_GENERATOR_WITH_CACHE_H_
 
 #include <string>
+#include <map>
+#include <ostream>
 
 #include "Base/XSecAlgorithmI.h"
 #include "EVGCore/EventRecordVisitorI.h"
 #include "Utils/Range1.h"
 
 using std::string;
+using std::map;
+using std::ostream;
 
 namespace genie {
 
@@ -42,6 +46,18 @@ class XSecAlgorithmI;
 
 class KineGeneratorWithCache : public EventRecordVisitorI {
 
+public:
+  //! Pre-compute & cache the max xsec for the input interaction & xsec model
+  //! at nknots energies in [Emin,Emax] (eg for building a cache file offline)
+  //! Returns false if too few values could be cached for building a spline
+  bool BuildMaxXSecCache (const Interaction * in, const XSecAlgorithmI * xsec_model,
+                          double Emin, double Emax, int nknots) const;
+
+  //! Overload the Algorithm::Configure() methods to drop the cache branch
+  //! configuration tags computed for the previous configuration
+  void Configure (const Registry & config);
+  void Configure (string config);
+
 protected:
   KineGeneratorWithCache();
   KineGeneratorWithCache(string name);
@@ -55,10 +71,14 @@ protected:
   virtual double Energy         (const Interaction * in) const;
 
   virtual CacheBranchFx * AccessCacheBranch (const Interaction * in) const;
+  virtual string          CacheConfigKey    (void) const;
+
+  void PrintConfigTree (const Algorithm * alg, ostream & stream, map<string,bool> & printed) const;
 
   virtual void AssertXSecLimits (const Interaction * in, double xsec, double xsec_max) const;
 
   mutable const XSecAlgorithmI * fXSecModel;
+  mutable map<string, string>    fCacheConfigKeys; ///< xsec model key -> config tag used in cache branch keys
 
   double fSafetyFactor;         ///< maxxsec -> maxxsec * safety_factor
   double fMaxXSecDiffTolerance; ///< max{100*(xsec-maxxsec)/.5*(xsec+maxxsec)} if xsec>maxxsec
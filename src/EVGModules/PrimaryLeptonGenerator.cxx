@@ -71,13 +71,13 @@ void PrimaryLeptonGenerator::ProcessEventRecord(GHepRecord * evrec) const
   TVector3 beta = this->NucRestFrame2Lab(evrec);
 
   // Neutrino 4p
-  TLorentzVector * p4v = evrec->Probe()->GetP4(); // v 4p @ LAB
-  p4v->Boost(-1.*beta);                           // v 4p @ Nucleon rest frame
+  TLorentzVector p4v(*evrec->Probe()->P4()); // v 4p @ LAB
+  p4v.Boost(-1.*beta);                        // v 4p @ Nucleon rest frame
 
   // Look-up selected kinematics & other needed kinematical params
   double Q2  = interaction->Kine().Q2(true);
   double y   = interaction->Kine().y(true);
-  double Ev  = p4v->E(); 
+  double Ev  = p4v.E(); 
   double ml  = interaction->FSPrimLepton()->Mass();
   double ml2 = TMath::Power(ml,2);
 
@@ -100,7 +100,7 @@ void PrimaryLeptonGenerator::ProcessEventRecord(GHepRecord * evrec) const
   double plty = plt * TMath::Sin(phi);
 
   // Take a unit vector along the neutrino direction @ the nucleon rest frame
-  TVector3 unit_nudir = p4v->Vect().Unit(); 
+  TVector3 unit_nudir = p4v.Vect().Unit(); 
 
   // Rotate lepton momentum vector from the reference frame (x'y'z') where 
   // {z':(neutrino direction), z'x':(theta plane)} to the nucleon rest frame
@@ -127,8 +127,6 @@ void PrimaryLeptonGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
   // Set final state lepton polarization
   this->SetPolarization(evrec);
-
-  delete p4v;
 }
 //___________________________________________________________________________
 TVector3 PrimaryLeptonGenerator::NucRestFrame2Lab(GHepRecord * evrec) const
@@ -29,7 +29,6 @@
 #include "Algorithm/AlgConfigPool.h"
 #include "Conventions/Constants.h"
 #include "Conventions/Controls.h"
-#include "EVGCore/EVGThreadException.h"
 #include "EVGModules/VertexGenerator.h"
 #include "GHEP/GHepStatus.h"
 #include "GHEP/GHepParticle.h"
@@ -39,7 +38,7 @@
 #include "Numerical/RandomGen.h"
 #include "PDG/PDGUtils.h"
 #include "Utils/PrintUtils.h"
-#include "Utils/NuclearUtils.h"
+#include "Utils/NuclearDensityTable.h"
 
 using namespace genie;
 using namespace genie::utils;
@@ -113,52 +112,20 @@ void VertexGenerator::ProcessEventRecord(GHepRecord * evrec) const
         //
         LOG("Vtx", pINFO) 
            << "Generating vertex according to a realistic nuclear density profile";
-        // get inputs to the rejection method
-        double ymax = -1;
+        // select a radial position by inverting the (tabulated) cumulative
+        // distribution of r^2*density
+        NuclearDensityTable * dtbl = NuclearDensityTable::Instance();
         double rmax = 3*R;
-        double dr   = R/40.;
-        for(double r = 0; r < rmax; r+=dr) { 
-           ymax = TMath::Max(ymax, r*r * utils::nuclear::Density(r,(int)A)); 
-        }
-        ymax *= 1.2;
-        
-        // select a vertex using the rejection method
-        unsigned int iter = 0;
-        while(1) {
-          iter++;
-          
-          // throw an exception if it hasn't find a solution after many attempts
-          if(iter > kRjMaxIterations) {
-               LOG("Vtx", pWARN)
-                 << "Couldn't generate a vertex position after " << iter << " iterations";
-               evrec->EventFlags()->SetBitNumber(kGenericErr, true);
-               genie::exceptions::EVGThreadException exception;
-               exception.SetReason("Couldn't generate vertex");
-               exception.SwitchOnFastForward();
-               throw exception;
-           }
-
-           double r = rmax * rnd->RndFsi().Rndm();
-           double t = ymax * rnd->RndFsi().Rndm();
-           double y = r*r * utils::nuclear::Density(r,(int)A);
-           if(y > ymax) {
-               LOG("Vtx", pERROR)
-                 << "y = " << y << " > ymax = " << ymax 
-                              << " for r = " << r << ", A = " << A;
-           }
-           bool accept = (t < y);
-           if(accept) {
-             double phi      = 2*kPi * rnd->RndFsi().Rndm();
-             double cosphi   = TMath::Cos(phi);
-             double sinphi   = TMath::Sin(phi);
-             double costheta = -1 + 2 * rnd->RndFsi().Rndm();
-             double sintheta = TMath::Sqrt(1-costheta*costheta);
-             vtx.SetX(r*sintheta*cosphi);
-             vtx.SetY(r*sintheta*sinphi);
-             vtx.SetZ(r*costheta);
-             break;
-           }
-        }//w(1)
+        double r    = dtbl->SelectRadius((int)A, rmax, rnd->RndFsi().Rndm());
+
+        double phi      = 2*kPi * rnd->RndFsi().Rndm();
+        double cosphi   = TMath::Cos(phi);
+        double sinphi   = TMath::Sin(phi);
+        double costheta = -1 + 2 * rnd->RndFsi().Rndm();
+        double sintheta = TMath::Sqrt(1-costheta*costheta);
+        vtx.SetX(r*sintheta*cosphi);
+        vtx.SetY(r*sintheta*sinphi);
+        vtx.SetZ(r*costheta);
       } //use density?
 
       if(uniform) {
@@ -757,6 +757,16 @@ void GNuMIFlux::LoadBeamSimData(std::vector<string> patterns, string config )
   // this will open all files and read header!!
   fNEntries = fNuFluxTree->GetEntries();
 
+  // read the flux chain baskets ahead, in bulk
+  if ( fReadCacheSize > 0 ) {
+    fNuFluxTree->SetCacheSize(fReadCacheSize);
+#if ROOT_VERSION_CODE >= ROOT_VERSION(5,26,0)
+    fNuFluxTree->AddBranchToCache("*",kTRUE);
+#endif
+    LOG("Flux", pINFO) 
+      << "Using a " << fReadCacheSize << " bytes read cache for the flux chain";
+  }
+
   if ( fNEntries == 0 ) {
     LOG("Flux", pERROR)
       << "!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!";
@@ -922,6 +932,15 @@ void GNuMIFlux::SetUpstreamZ(double z0)
   fZ0 = z0;
 }
 //___________________________________________________________________________
+void GNuMIFlux::SetReadCacheSize(Long64_t nbytes)
+{
+// Size of the TTreeCache used to read the flux chain. The cache reads the
+// baskets of all branches ahead, in bulk, which matters most when the flux
+// files are on networked storage.
+
+  fReadCacheSize = TMath::Max((Long64_t)0, nbytes);
+}
+//___________________________________________________________________________
 void GNuMIFlux::SetNumOfCycles(long int ncycle)
 {
 // The flux ntuples can be recycled for a number of times to boost generated
@@ -1215,6 +1234,7 @@ void GNuMIFlux::Initialize(void)
   fNFiles          =  0;
 
   fNEntries        =  0;
+  fReadCacheSize   =  10000000;
   fIEntry          = -1;
   fNCycles         =  0;
   fICycle          =  0;
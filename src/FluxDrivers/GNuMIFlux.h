@@ -6,6 +6,9 @@
 \brief    A GENIE flux driver encapsulating the NuMI neutrino flux.
           It reads-in the official GNUMI neutrino flux ntuples.
           Supports both geant3 and geant4 formats.
+          Entries are read through a TTreeCache (see SetReadCacheSize()), so
+          that the baskets of the flux chain are read ahead in bulk rather
+          than one entry at a time.
 
 \ref      http://www.hep.utexas.edu/~zarko/wwwgnumi/v19/
 
@@ -331,6 +334,7 @@ public :
   void      GetFluxWindow(TVector3& p1, TVector3& p2, TVector3& p3) const; ///< 3 points define a plane in beam coordinate 
 
   void      SetUpstreamZ(double z0);                           ///< set flux neutrino initial z position (upstream of the detector) pushed back from the flux window
+  void      SetReadCacheSize(Long64_t nbytes);                  ///< size of the read-ahead cache (TTreeCache) of the flux chain (0: none; set before LoadBeamSimData)
 
   /// force weights at MINOS detector "center" as found in ntuple
   void      UseFluxAtNearDetCenter(void);
@@ -383,6 +387,7 @@ private:
   flugg*    fFlugg;               ///< flugg ntuple
   int       fNFiles;              ///< number of files in chain
   Long64_t  fNEntries;            ///< number of flux ntuple entries
+  Long64_t  fReadCacheSize;       ///< size of TTreeCache for the flux chain
   Long64_t  fIEntry;              ///< current flux ntuple entry
   Long64_t  fNuTot;               ///< cummulative # of entries (=fNEntries)
   Long64_t  fFilePOTs;            ///< # of protons-on-target represented by all files
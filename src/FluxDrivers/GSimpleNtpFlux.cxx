@@ -189,7 +189,9 @@ bool GSimpleNtpFlux::GenerateNext_weighted(void)
       }
     }
     
-    int nbytes = fNuFluxTree->GetEntry(fIEntry);
+    int nbytes = 0;
+    if ( fResident ) this->GetResidentEntry(fIEntry);
+    else             nbytes = fNuFluxTree->GetEntry(fIEntry);
     UInt_t metakey = fCurEntry->metakey;
     if ( fAllFilesMeta && ( fCurMeta->metakey != metakey ) ) {
       UInt_t oldkey = fCurMeta->metakey;
@@ -198,33 +200,19 @@ bool GSimpleNtpFlux::GenerateNext_weighted(void)
 #else
       // unordered indices makes ROOT call Error() which might,
       // if not DefaultErrorHandler, be fatal.
-      // so find the right one by a simple linear search.
-      // not a large burden since it only happens infrequently and
-      // the list is normally quite short.
-      int nmeta = fNuMetaTree->GetEntries();
-      int nbmeta = 0;
-      for (int imeta = 0; imeta < nmeta; ++imeta ) {
-        nbmeta = fNuMetaTree->GetEntry(imeta);
-        if ( fCurMeta->metakey == metakey ) break;
-      }
-      // next condition should never happen
-      if ( fCurMeta->metakey != metakey ) {
-        fCurMeta = 0; // didn't find it!?
-        LOG("Flux",pERROR) << "Failed to find right metakey=" << metakey
-                           << " (was " << oldkey << ") out of " << nmeta 
-                           << " entries";
-      }
+      // so look the entry up in the metakey index built by ProcessMeta()
+      int nbmeta = this->GetMeta(metakey);
 #endif
       LOG("Flux",pDEBUG) << "Get meta " << metakey 
                          << " (was " << oldkey << ") "
-                         << fCurMeta->metakey 
+                         << ((fCurMeta) ? (int) fCurMeta->metakey : -1)
                          << " nb " << nbytes << " " << nbmeta;
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
       LOG("Flux",pDEBUG) << "Get meta " << *fCurMeta; 
 #endif
     }
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-    Int_t ifile = fNuFluxTree->GetFileNumber();
+    Int_t ifile = (fResident) ? -1 : fNuFluxTree->GetFileNumber();
     LOG("Flux",pDEBUG)
       << "got " << fNNeutrinos << " nu, using fIEntry " << fIEntry 
       << " ifile " << ifile << " nbytes " << nbytes
@@ -520,7 +508,18 @@ void GSimpleNtpFlux::LoadBeamSimData(std::vector<string> patterns, string config
     << " \"numi\"=" << sba_status[1]
     << " \"aux\"=" << sba_status[2];
 
-  // attach requested branches
+  // read the flux chain baskets ahead, in bulk
+  if ( fReadCacheSize > 0 ) {
+    fNuFluxTree->SetCacheSize(fReadCacheSize);
+#if ROOT_VERSION_CODE >= ROOT_VERSION(5,26,0)
+    fNuFluxTree->AddBranchToCache("*",kTRUE);
+#endif
+    LOG("Flux", pINFO) 
+      << "Using a " << fReadCacheSize << " bytes read cache for the flux chain";
+  }
+
+  // serve all entries from memory if they fit
+  this->LoadResident();
 
   if (fMaxWeight<=0) {
      LOG("Flux", pDEBUG)
@@ -568,9 +567,11 @@ void GSimpleNtpFlux::ProcessMeta(void)
     int nindices = fNuMetaTree->BuildIndex("metakey"); // key used to tie entries to meta data
     LOG("Flux", pDEBUG) << "ProcessMeta() BuildIndex nindices " << nindices;
 #endif
+    fMetaIndex.clear();
     int nmeta = fNuMetaTree->GetEntries();
     for (int imeta = 0; imeta < nmeta; ++imeta ) {
       fNuMetaTree->GetEntry(imeta);
+      fMetaIndex[fCurMeta->metakey] = imeta;
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
       LOG("Flux", pNOTICE) << "ProcessMeta() ifile " << imeta
                            << " (of " << fNFiles
@@ -654,6 +655,126 @@ void GSimpleNtpFlux::SetEntryReuse(long int nuse)
   fNUse    = TMath::Max(1L, nuse);
 }
 //___________________________________________________________________________
+void GSimpleNtpFlux::SetReadCacheSize(Long64_t nbytes)
+{
+// Size of the TTreeCache used to read the flux chain. The cache reads the
+// baskets of all branches ahead, in bulk, which matters most when the flux
+// files are on networked storage.
+
+  fReadCacheSize = TMath::Max((Long64_t)0, nbytes);
+}
+//___________________________________________________________________________
+void GSimpleNtpFlux::SetMaxResidentSize(Long64_t nbytes)
+{
+// If the "entry" branch data of all flux entries take at most nbytes, they
+// are loaded in memory by LoadBeamSimData and the flux chain is not read
+// again while generating events.
+
+  fMaxResidentSize = TMath::Max((Long64_t)0, nbytes);
+}
+//___________________________________________________________________________
+void GSimpleNtpFlux::LoadResident(void)
+{
+  fResident = false;
+  fResWgt.clear();  fResVtxX.clear(); fResVtxY.clear(); fResVtxZ.clear();
+  fResDist.clear(); fResPx.clear();   fResPy.clear();   fResPz.clear();
+  fResE.clear();    fResPdg.clear();  fResMetaKey.clear();
+
+  if ( fMaxResidentSize <= 0 || fNEntries <= 0 ) return;
+
+  // the other branches would be left unread
+  if ( fCurNuMI || fCurAux ) {
+    LOG("Flux", pNOTICE)
+      << "The \"numi\" or \"aux\" branch is attached: "
+      << "Flux entries will not be held in memory";
+    return;
+  }
+
+  const Long64_t entry_size = 9*sizeof(Double_t) + sizeof(Int_t) + sizeof(UInt_t);
+  if ( fNEntries * entry_size > fMaxResidentSize ) {
+    LOG("Flux", pNOTICE)
+      << "Flux entries need " << fNEntries * entry_size << " bytes (> " 
+      << fMaxResidentSize << "): Flux entries will not be held in memory";
+    return;
+  }
+
+  LOG("Flux", pNOTICE) 
+    << "Loading " << fNEntries << " flux entries in memory";
+
+  fResWgt    .resize(fNEntries);
+  fResVtxX   .resize(fNEntries);
+  fResVtxY   .resize(fNEntries);
+  fResVtxZ   .resize(fNEntries);
+  fResDist   .resize(fNEntries);
+  fResPx     .resize(fNEntries);
+  fResPy     .resize(fNEntries);
+  fResPz     .resize(fNEntries);
+  fResE      .resize(fNEntries);
+  fResPdg    .resize(fNEntries);
+  fResMetaKey.resize(fNEntries);
+
+  for (Long64_t i = 0; i < fNEntries; ++i ) {
+    fNuFluxTree->GetEntry(i);
+    fResWgt    [i] = fCurEntry->wgt;
+    fResVtxX   [i] = fCurEntry->vtxx;
+    fResVtxY   [i] = fCurEntry->vtxy;
+    fResVtxZ   [i] = fCurEntry->vtxz;
+    fResDist   [i] = fCurEntry->dist;
+    fResPx     [i] = fCurEntry->px;
+    fResPy     [i] = fCurEntry->py;
+    fResPz     [i] = fCurEntry->pz;
+    fResE      [i] = fCurEntry->E;
+    fResPdg    [i] = fCurEntry->pdg;
+    fResMetaKey[i] = fCurEntry->metakey;
+  }
+  fCurEntry->Reset();
+
+  fResident = true;
+}
+//___________________________________________________________________________
+void GSimpleNtpFlux::GetResidentEntry(Long64_t ientry)
+{
+  fCurEntry->wgt     = fResWgt    [ientry];
+  fCurEntry->vtxx    = fResVtxX   [ientry];
+  fCurEntry->vtxy    = fResVtxY   [ientry];
+  fCurEntry->vtxz    = fResVtxZ   [ientry];
+  fCurEntry->dist    = fResDist   [ientry];
+  fCurEntry->px      = fResPx     [ientry];
+  fCurEntry->py      = fResPy     [ientry];
+  fCurEntry->pz      = fResPz     [ientry];
+  fCurEntry->E       = fResE      [ientry];
+  fCurEntry->pdg     = fResPdg    [ientry];
+  fCurEntry->metakey = fResMetaKey[ientry];
+}
+//___________________________________________________________________________
+int GSimpleNtpFlux::GetMeta(UInt_t metakey)
+{
+// Read the meta data entry for the input metakey.
+// Returns the number of bytes read for the last meta data entry read.
+// If no entry matches, fCurMeta is reset to 0.
+
+  int nbmeta = 0;
+
+  std::map<UInt_t,Long64_t>::const_iterator it = fMetaIndex.find(metakey);
+  if ( it != fMetaIndex.end() ) {
+    nbmeta = fNuMetaTree->GetEntry(it->second);
+    if ( fCurMeta->metakey == metakey ) return nbmeta;
+  }
+
+  // not indexed (or stale index): fall back to a linear search
+  int nmeta = fNuMetaTree->GetEntries();
+  for (int imeta = 0; imeta < nmeta; ++imeta ) {
+    nbmeta = fNuMetaTree->GetEntry(imeta);
+    fMetaIndex[fCurMeta->metakey] = imeta;
+    if ( fCurMeta->metakey == metakey ) return nbmeta;
+  }
+  // next condition should never happen
+  fCurMeta = 0; // didn't find it!?
+  LOG("Flux",pERROR) << "Failed to find right metakey=" << metakey
+                     << " out of " << nmeta << " entries";
+  return nbmeta;
+}
+//___________________________________________________________________________
 void GSimpleNtpFlux::GetFluxWindow(TVector3& p0, TVector3& p1, TVector3& p2) const
 {
   // return flux window points
@@ -740,6 +861,10 @@ void GSimpleNtpFlux::Initialize(void)
   fAllFilesMeta    = true;
   fAlreadyUnwgt    = false;
 
+  fReadCacheSize   = 10000000;
+  fMaxResidentSize = 0;
+  fResident        = false;
+
   this->SetDefaults();
   this->ResetCurrent();
 }
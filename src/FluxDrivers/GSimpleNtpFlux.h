@@ -5,6 +5,14 @@
 
 \brief    A GENIE flux driver using a simple ntuple format
 
+          Entries are read through a TTreeCache (see SetReadCacheSize()), so
+          that the baskets of the flux chain are read ahead in bulk rather
+          than one entry at a time. Meta data are located through a metakey
+          index built when the meta data are processed. If all the "entry"
+          branch data fit in SetMaxResidentSize() bytes (and no "numi" or
+          "aux" branch is attached) they are loaded in memory up front and
+          all later entries are served from memory.
+
 \author   Robert Hatcher <rhatcher \at fnal.gov>
           Fermi National Accelerator Laboratory
 
@@ -23,6 +31,7 @@
 #include <iostream>
 #include <vector>
 #include <set>
+#include <map>
 
 #include <TVector3.h>
 #include <TLorentzVector.h>
@@ -262,6 +271,10 @@ public :
 
   void      SetUpstreamZ(double z0);                           ///< set flux neutrino initial z position (upstream of the detector) pushed back from the flux window
 
+  void      SetReadCacheSize(Long64_t nbytes);                  ///< size of the read-ahead cache (TTreeCache) of the flux chain (0: none; set before LoadBeamSimData)
+  void      SetMaxResidentSize(Long64_t nbytes);                ///< keep all "entry" branch data in memory if it takes at most nbytes (0: never; set before LoadBeamSimData)
+  bool      IsResident(void) const { return fResident; }        ///< are flux entries served from memory?
+
 private:
 
   // Private methods
@@ -275,6 +288,9 @@ private:
   bool OptionalAttachBranch  (std::string bname);
   void CalcEffPOTsPerNu      (void);
   void ScanMeta              (void);
+  void LoadResident          (void);
+  void GetResidentEntry      (Long64_t ientry);
+  int  GetMeta               (UInt_t metakey);
 
   // Private data members
   //
@@ -321,6 +337,24 @@ private:
   TLorentzVector   fP4;        ///< reconstituted p4 vector
   TLorentzVector   fX4;        ///< reconstituted position vector
   GSimpleNtpMeta*  fCurMeta;   ///< current meta data 
+
+  Long64_t  fReadCacheSize;       ///< size of TTreeCache for the flux chain
+  Long64_t  fMaxResidentSize;     ///< max memory to hold all entries in memory
+  std::map<UInt_t,Long64_t> fMetaIndex; ///< metakey -> entry in the meta chain
+
+  // "entry" branch data held in memory (struct-of-arrays), if fResident
+  bool                  fResident;  ///< are flux entries served from memory?
+  std::vector<Double_t> fResWgt;    ///< entry wgt
+  std::vector<Double_t> fResVtxX;   ///< entry vtxx
+  std::vector<Double_t> fResVtxY;   ///< entry vtxy
+  std::vector<Double_t> fResVtxZ;   ///< entry vtxz
+  std::vector<Double_t> fResDist;   ///< entry dist
+  std::vector<Double_t> fResPx;     ///< entry px
+  std::vector<Double_t> fResPy;     ///< entry py
+  std::vector<Double_t> fResPz;     ///< entry pz
+  std::vector<Double_t> fResE;      ///< entry E
+  std::vector<Int_t>    fResPdg;    ///< entry pdg
+  std::vector<UInt_t>   fResMetaKey;///< entry metakey
 };
 
 } // flux namespace
@@ -252,11 +252,7 @@ TClonesArray * CharmHadronization::Hadronize(
         assert(permitted);
  
         // Get the maximum weight
-        double wmax = -1;
-        for(int i=0; i<200; i++) {
-           double w = fPhaseSpaceGenerator.Generate();
-           wmax = TMath::Max(wmax,w);
-        }
+        double wmax = fPhaseSpaceGenerator.MaxWeight();
 
         if(wmax>0) {
            wmax *= 2;
@@ -592,11 +588,7 @@ TClonesArray * CharmHadronization::Hadronize(
        return 0;
      }
      // Get the maximum weight
-     double wmax = -1;
-     for(int i=0; i<200; i++) {
-       double w = fPhaseSpaceGenerator.Generate();
-       wmax = TMath::Max(wmax,w);
-     }
+     double wmax = fPhaseSpaceGenerator.MaxWeight();
      if(wmax<=0) {
        LOG("CharmHad", pERROR) << " *** Non-positive maximum weight";
        LOG("CharmHad", pERROR) << " *** Can not generate an unweighted phase space decay";
@@ -23,9 +23,8 @@
 #ifndef _CHARM_HADRONIZATION_H_
 #define _CHARM_HADRONIZATION_H_
 
-#include <TGenPhaseSpace.h>
-
 #include "Fragmentation/HadronizationModelI.h"
+#include "Utils/NBodyPhaseSpace.h"
 
 class TPythia6;
 class TF1;
@@ -61,7 +60,7 @@ private:
   void LoadConfig          (void);
   int  GenerateCharmHadron (int nupdg, double EvLab) const;
 
-  mutable TGenPhaseSpace fPhaseSpaceGenerator; ///< a phase space generator
+  mutable NBodyPhaseSpace fPhaseSpaceGenerator; ///< a phase space generator
 
   // Configuration parameters
   //
@@ -935,13 +935,20 @@ bool KNOHadronization::PhaseSpaceDecay(
      return false;
   }
 
-  // Get the maximum weight
-  //double wmax = fPhaseSpaceGenerator.GetWtMax();
+  // Get the maximum weight.
+  // Without pT reweighting, the max weight depends only on the decay product
+  // masses and the invariant mass of the decaying system and is taken from
+  // the table kept by the phase space generator. The pT^2 reweighting factor
+  // depends on the frame, so the max weight is estimated for each decay.
   double wmax = -1;
-  for(int i=0; i<200; i++) {
-     double w = fPhaseSpaceGenerator.Generate();   
-     if(reweight) { w *= this->ReWeightPt2(pdgv); }
-     wmax = TMath::Max(wmax,w);
+  if(reweight) {
+    for(int i=0; i<200; i++) {
+       double w = fPhaseSpaceGenerator.Generate();   
+       w *= this->ReWeightPt2(pdgv);
+       wmax = TMath::Max(wmax,w);
+    }
+  } else {
+    wmax = fPhaseSpaceGenerator.MaxWeight();
   }
   assert(wmax>0);
 
@@ -33,9 +33,8 @@
 #ifndef _KNO_HADRONIZATION_H_
 #define _KNO_HADRONIZATION_H_
 
-#include <TGenPhaseSpace.h>
-
 #include "Fragmentation/HadronizationModelBase.h"
+#include "Utils/NBodyPhaseSpace.h"
 
 class TF1;
 
@@ -85,8 +84,8 @@ private:
          TClonesArray & pl, TLorentzVector & pd, 
 	   const PDGCodeList & pdgv, int offset=0, bool reweight=false) const;
 
-  mutable TGenPhaseSpace fPhaseSpaceGenerator; ///< a phase space generator
-  mutable double         fWeight;              ///< weight for generated event
+  mutable NBodyPhaseSpace fPhaseSpaceGenerator; ///< a phase space generator
+  mutable double          fWeight;             ///< weight for generated event
 
   // Configuration parameters
   // Note: additional configuration parameters common to all hadronizers
@@ -4,6 +4,10 @@
 \class   genie::GHepParticle
 
 \brief   STDHEP-like event record entry that can fit a particle or a nucleus.
+         The momentum and position 4-vectors are data members (rather than
+         heap-allocated objects as in class versions <= 2), so creating,
+         copying and clearing entries needs no memory allocation.
+         Use P4() / X4() to access them; GetP4() / GetX4() return clones.
 
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          STFC, Rutherford Appleton Laboratory
@@ -70,24 +74,24 @@ public :
   double Charge (void) const; ///< Chrg that corresponds to the PDG code
 
   // Returns the momentum & position 4-vectors
-  TLorentzVector * P4 (void) const { return fP4; }
-  TLorentzVector * X4 (void) const { return fX4; }
+  TLorentzVector * P4 (void) const { return const_cast<TLorentzVector *>(&fP4); }
+  TLorentzVector * X4 (void) const { return const_cast<TLorentzVector *>(&fX4); }
 
   // Hand over clones of the momentum & position 4-vectors (+ their ownership)
   TLorentzVector * GetP4 (void) const;
   TLorentzVector * GetX4 (void) const;
 
   // Returns the momentum & position 4-vectors components
-  double Px     (void) const { return (fP4) ? fP4->Px()     : 0; } ///< Get Px
-  double Py     (void) const { return (fP4) ? fP4->Py()     : 0; } ///< Get Py
-  double Pz     (void) const { return (fP4) ? fP4->Pz()     : 0; } ///< Get Pz 
-  double E      (void) const { return (fP4) ? fP4->Energy() : 0; } ///< Get energy
-  double Energy (void) const { return this->E();                 } ///< Get energy
-  double KinE   (bool mass_from_pdg = false) const;                ///< Get kinetic energy
-  double Vx     (void) const { return (fX4) ? fX4->X()      : 0; } ///< Get production x
-  double Vy     (void) const { return (fX4) ? fX4->Y()      : 0; } ///< Get production y
-  double Vz     (void) const { return (fX4) ? fX4->Z()      : 0; } ///< Get production z
-  double Vt     (void) const { return (fX4) ? fX4->T()      : 0; } ///< Get production time
+  double Px     (void) const { return fP4.Px();     } ///< Get Px
+  double Py     (void) const { return fP4.Py();     } ///< Get Py
+  double Pz     (void) const { return fP4.Pz();     } ///< Get Pz 
+  double E      (void) const { return fP4.Energy(); } ///< Get energy
+  double Energy (void) const { return this->E();    } ///< Get energy
+  double KinE   (bool mass_from_pdg = false) const;   ///< Get kinetic energy
+  double Vx     (void) const { return fX4.X();      } ///< Get production x
+  double Vy     (void) const { return fX4.Y();      } ///< Get production y
+  double Vz     (void) const { return fX4.Z();      } ///< Get production z
+  double Vt     (void) const { return fX4.T();      } ///< Get production time
 
   // Return removal energy /set only for bound nucleons/
   double RemovalEnergy (void) const { return fRemovalEnergy; } ///< Get removal energy 
@@ -171,14 +175,14 @@ private:
   int              fLastMother;     ///< last mother idx
   int              fFirstDaughter;  ///< first daughter idx
   int              fLastDaughter;   ///< last daughter idx
-  TLorentzVector * fP4;             ///< momentum 4-vector (GeV)
-  TLorentzVector * fX4;             ///< position 4-vector (in the target nucleus coordinate system / x,y,z in fm / t=0)
+  TLorentzVector   fP4;             ///< momentum 4-vector (GeV)
+  TLorentzVector   fX4;             ///< position 4-vector (in the target nucleus coordinate system / x,y,z in fm / t=0)
   double           fPolzTheta;      ///< polar polarization angle (rad)
   double           fPolzPhi;        ///< azimuthal polarization angle (rad)
   double           fRemovalEnergy;  ///< removal energy for bound nucleons (GeV)
   bool             fIsBound;        ///< 'is it a bound particle?' flag
 
-ClassDef(GHepParticle, 2)
+ClassDef(GHepParticle, 3)
 
 };
 
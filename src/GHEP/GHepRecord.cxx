@@ -139,6 +139,10 @@ Interaction * GHepRecord::Summary(void) const
 //___________________________________________________________________________
 void GHepRecord::AttachSummary(Interaction * interaction)
 {
+// Adopts the input interaction summary (deleting any summary that was
+// attached earlier)
+
+  if(fInteraction && fInteraction != interaction) delete fInteraction;
   fInteraction = interaction;
 }
 //___________________________________________________________________________
@@ -904,6 +908,45 @@ void GHepRecord::ResetRecord(void)
   this->InitRecord();
 }
 //___________________________________________________________________________
+void GHepRecord::ReuseRecord(void)
+{
+// Resets the event record so that it can be used for another event, but
+// keeps everything already allocated: The particle slots of the underlying
+// TClonesArray, the vertex, the event flag and mask bit-fields and the
+// summary Interaction (which is to be overwritten by the caller, eg via
+// Interaction::Copy()).
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("GHEP", pDEBUG) << "Reusing GHepRecord";
+#endif
+  TClonesArray::Clear("C");
+
+  fWeight       = 1.;
+  fProb         = 1.;
+  fXSec         = 0.;
+  fDiffXSec     = 0.;
+  fDiffXSecPhSp = kPSNull;
+
+  if(fVtx) fVtx->SetXYZT(0,0,0,0);
+  else     fVtx = new TLorentzVector(0,0,0,0);
+
+  if(!fEventFlags) fEventFlags = new TBits(GHepFlags::NFlags());
+  fEventFlags -> ResetAllBits(false);
+
+  if(!fEventMask) fEventMask = new TBits(GHepFlags::NFlags());
+  for(unsigned int i = 0; i < GHepFlags::NFlags(); i++) {
+   fEventMask->SetBitNumber(i, true);
+  }
+
+  // clear the bits set on the summary when the last event was generated
+  if(fInteraction) {
+    fInteraction->ResetBit(kISkipProcessChk);
+    fInteraction->ResetBit(kISkipKinematicChk);
+    fInteraction->ResetBit(kIAssumeFreeNucleon);
+    fInteraction->ResetBit(kINoNuclearCorrection);
+  }
+}
+//___________________________________________________________________________
 void GHepRecord::Clear(Option_t * opt)
 {
   if (fInteraction) delete fInteraction;
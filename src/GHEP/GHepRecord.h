@@ -140,6 +140,7 @@ public :
   virtual void Copy        (const GHepRecord & record);
   virtual void Clear       (Option_t * opt="");
   virtual void ResetRecord (void);
+  virtual void ReuseRecord (void);
   virtual void CompactifyDaughterLists     (void);
   virtual void RemoveIntermediateParticles (void);
 
@@ -15,4 +15,12 @@
 
 #pragma link C++ ioctortype TRootIOCtor;
 
+// GHepParticle versions <= 2 stored its 4-vectors as heap-allocated objects
+#pragma read sourceClass="genie::GHepParticle" targetClass="genie::GHepParticle" \
+  version="[-2]" source="TLorentzVector* fP4; TLorentzVector* fX4" \
+  target="fP4,fX4" \
+  code="{ if(onfile.fP4) fP4 = *onfile.fP4; else fP4.SetPxPyPzE(0,0,0,0); \
+          if(onfile.fX4) fX4 = *onfile.fX4; else fX4.SetXYZT(0,0,0,0); \
+        }"
+
 #endif
@@ -254,13 +254,33 @@ const PathLengthList & ROOTGeomAnalyzer::ComputePathLengths(
   // reset current list of path-lengths
   fCurrPathLengthList->SetAllToZero();
 
-  //loop over materials & compute the path-length
-  vector<int>::iterator itr;
-  for (itr=fCurrPDGCodeList->begin();itr!=fCurrPDGCodeList->end();itr++) {
+  // swim through the geometry once and sum the (weighted) steps in each
+  // material for all target nuclei at once
+  this->SwimOnce(pos,udir);
 
-    int pdgc = *itr;
+  unsigned int ntgt = fCurrPDGCodeList->size();
+  fCurrPlBuffer.assign(ntgt, 0.);
 
-    Double_t pl = this->ComputePathLengthPDG(pos,udir,pdgc);
+  PathSegmentList::MaterialMapCItr_t mitr     = 
+    fCurrPathSegmentList->GetMatStepSumMap().begin();
+  PathSegmentList::MaterialMapCItr_t mitr_end = 
+    fCurrPathSegmentList->GetMatStepSumMap().end();
+  for ( ; mitr != mitr_end; ++mitr ) {
+    const TGeoMaterial * mat = mitr->first;
+    if ( ! mat ) continue;  // segment outside geometry has no material
+    double step = mitr->second;
+    const vector<double> & weights = this->MaterialWeights(mat);
+    for (unsigned int itgt = 0; itgt < ntgt; itgt++) {
+      fCurrPlBuffer[itgt] += (step*weights[itgt]);
+    }
+  }
+
+  //loop over materials & store the path-length
+  for (unsigned int itgt = 0; itgt < ntgt; itgt++) {
+
+    int pdgc = (*fCurrPDGCodeList)[itgt];
+
+    Double_t pl = fCurrPlBuffer[itgt];
     fCurrPathLengthList->AddPathLength(pdgc,pl);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
@@ -345,7 +365,8 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
   }
 #endif
 
-  // compute the pdg weight for each material just once, then use a stl map 
+  // get the pdg weight for each material just once, then use a stl map 
+  int itgt = this->TargetIndex(tgtpdg);
   PathSegmentList::MaterialMap_t wgtmap;
   PathSegmentList::MaterialMapCItr_t mitr     = 
     fCurrPathSegmentList->GetMatStepSumMap().begin();
@@ -355,7 +376,7 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
   // steps outside the geometry may have no assigned material
   for ( ; mitr != mitr_end; ++mitr ) {
     const TGeoMaterial* mat = mitr->first;
-    double wgt = ( mat ) ? this->GetWeight(mat,tgtpdg) : 0;
+    double wgt = ( mat && itgt >= 0 ) ? this->MaterialWeights(mat)[itgt] : 0;
     wgtmap[mat] = wgt;
 #ifdef RWH_DEBUG
     if ( ( fDebugFlags & 0x02 ) ) {
@@ -508,6 +529,18 @@ void ROOTGeomAnalyzer::SetMixtureWeightsSum(double sum)
 /// compute the correct weight normalization.
 
   fMixtWghtSum = sum;
+
+  // update the material weight table if a geometry is already loaded
+  if (fCurrPDGCodeList) this->BuildMaterialWeightTable();
+}
+
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::SetWeightWithDensity(bool wt)
+{
+  fDensWeight = wt;
+
+  // update the material weight table if a geometry is already loaded
+  if (fCurrPDGCodeList) this->BuildMaterialWeightTable();
 }
 
 //___________________________________________________________________________
@@ -737,6 +770,8 @@ void ROOTGeomAnalyzer::Initialize(void)
   this -> SetScannerNRays      (200);
   this -> SetScannerNParticles (10000);
   this -> SetScannerFlux       (0);
+  this -> SetScannerTolerance  (0);
+  this -> SetScannerNRefineRays(1000);
   this -> SetMaxPlSafetyFactor (1.1);
   this -> SetLengthUnits       (genie::units::meter);
   this -> SetDensityUnits      (genie::units::kilogram/genie::units::meter3);
@@ -795,6 +830,7 @@ void ROOTGeomAnalyzer::Load(TGeoManager * gm)
   assert(fGeometry);
 
   this->BuildListOfTargetNuclei();
+  this->BuildMaterialWeightTable();
 
   const PDGCodeList & pdglist = this->ListOfTargetNuclei();
 
@@ -1042,6 +1078,66 @@ double ROOTGeomAnalyzer::GetWeight(const TGeoMixture* mixt, int ielement, int pd
   return weight;
 }
 
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::BuildMaterialWeightTable(void)
+{
+/// Tabulate the weight of each target nucleus in each of the materials used 
+/// by the geometry volumes.
+
+  fMatWeights.clear();
+
+  if (!fGeometry || !fCurrPDGCodeList) return;
+
+  TObjArray * volume_list = fGeometry->GetListOfVolumes();
+  if (!volume_list) return;
+
+  int numVol = volume_list->GetEntries();
+  for (int ivol = 0; ivol < numVol; ivol++) {
+      TGeoVolume * volume = dynamic_cast <TGeoVolume *>(volume_list->At(ivol));
+      if (!volume) continue;
+      const TGeoMaterial * mat = volume->GetMedium()->GetMaterial();
+      this->MaterialWeights(mat);
+  }
+
+  LOG("GROOTGeom", pNOTICE)
+     << "Tabulated the weights of " << fCurrPDGCodeList->size()
+     << " target nuclei in " << fMatWeights.size() << " materials";
+}
+
+//___________________________________________________________________________
+const vector<double> & ROOTGeomAnalyzer::MaterialWeights(
+                                                 const TGeoMaterial * mat)
+{
+/// Get the weight of each target nucleus (in the order of the list of 
+/// target nuclei) in the input material. The weights are computed the
+/// first time a material is met and are kept for later use.
+/// Weights are in the curr geom density units.
+
+  map<const TGeoMaterial *, vector<double> >::const_iterator it =
+                                                   fMatWeights.find(mat);
+  if (it != fMatWeights.end()) return it->second;
+
+  vector<double> & weights = fMatWeights[mat];
+  weights.resize(fCurrPDGCodeList->size(), 0.);
+  for (unsigned int itgt = 0; itgt < weights.size(); itgt++) {
+     weights[itgt] = this->GetWeight(mat, (*fCurrPDGCodeList)[itgt]);
+  }
+  return weights;
+}
+
+//___________________________________________________________________________
+int ROOTGeomAnalyzer::TargetIndex(int pdgc) const
+{
+/// Position of the input target nucleus in the (sorted) list of target 
+/// nuclei, or -1 if the target is not in the list.
+
+  PDGCodeList::const_iterator it = std::lower_bound(
+         fCurrPDGCodeList->begin(), fCurrPDGCodeList->end(), pdgc);
+  if (it == fCurrPDGCodeList->end() || *it != pdgc) return -1;
+
+  return it - fCurrPDGCodeList->begin();
+}
+
 //___________________________________________________________________________
 void ROOTGeomAnalyzer::MaxPathLengthsFluxMethod(void)
 {
@@ -1124,7 +1220,10 @@ void ROOTGeomAnalyzer::MaxPathLengthsBoxMethod(void)
   TLorentzVector nux4;
   TLorentzVector nup4;
 
-  PathLengthList::const_iterator pl_iter;
+  unsigned int ntgt = fCurrPDGCodeList->size();
+  fMaxPlRayFace.assign(ntgt, -1);
+  fMaxPlRayPos.assign (ntgt, TVector3(0,0,0));
+  fMaxPlRayDir.assign (ntgt, TVector3(0,0,0));
 
   while ( (ok = this->GenBoxRay(iparticle++,nux4,nup4)) ) {
 
@@ -1135,17 +1234,12 @@ void ROOTGeomAnalyzer::MaxPathLengthsBoxMethod(void)
 
     const PathLengthList & pl = this->ComputePathLengths(nux4, nup4);
 
-    for (pl_iter = pl.begin(); pl_iter != pl.end(); ++pl_iter) {
-       int    pdgc = pl_iter->first;
-       double pl   = pl_iter->second;
-
-       if (pl>0) {
-          pl *= (this->MaxPlSafetyFactor());
+    this->UpdateMaxPathLengths(pl, fiface, fGenBoxRayPosTop, fGenBoxRayDirTop);
+  }
 
-          pl = TMath::Max(pl, fCurrMaxPathLengthList->PathLength(pdgc));
-          fCurrMaxPathLengthList->SetPathLength(pdgc,pl);
-       }
-    }
+  // refine the max path lengths around the best rays found so far
+  if ( fScannerTol > 0 ) {
+    this->RefineMaxPathLengths();
   }
 
   // print out the results
@@ -1335,6 +1429,10 @@ bool ROOTGeomAnalyzer::GenBoxRay(int indx, TLorentzVector& x4, TLorentzVector& p
       << " p " << utils::print::P3AsString(&fGenBoxRayDir);
 #endif
 
+  // keep the ray in top vol coord & units (see RefineMaxPathLengths())
+  if ( fnewpnt ) fGenBoxRayPosTop = fGenBoxRayPos;
+  fGenBoxRayDirTop = fGenBoxRayDir.Unit();
+
   if ( fnewpnt ) {
     if ( ! fMasterToTopIsIdentity) {
       this->Top2Master(fGenBoxRayPos); // transform position (top -> master)
@@ -1358,6 +1456,161 @@ bool ROOTGeomAnalyzer::GenBoxRay(int indx, TLorentzVector& x4, TLorentzVector& p
   return true;
 }
 
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::UpdateMaxPathLengths(const PathLengthList & pl, 
+                     int iface, const TVector3 & pos, const TVector3 & dir)
+{
+/// Update the max path lengths with the path lengths computed for the input
+/// box ray (face, position & direction in top vol coord & units), and keep
+/// the rays giving the current max path length for each material
+
+  PathLengthList::const_iterator pl_iter;
+
+  for (pl_iter = pl.begin(); pl_iter != pl.end(); ++pl_iter) {
+     int    pdgc   = pl_iter->first;
+     double length = pl_iter->second;
+
+     if (length>0) {
+        length *= (this->MaxPlSafetyFactor());
+
+        if ( length > fCurrMaxPathLengthList->PathLength(pdgc) ) {
+          fCurrMaxPathLengthList->SetPathLength(pdgc,length);
+
+          int itgt = this->TargetIndex(pdgc);
+          if ( itgt >= 0 && itgt < (int)fMaxPlRayFace.size() ) {
+            fMaxPlRayFace[itgt] = iface;
+            fMaxPlRayPos [itgt] = pos;
+            fMaxPlRayDir [itgt] = dir;
+          }
+        }
+     }
+  }
+}
+
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::RefineMaxPathLengths(void)
+{
+/// Refine the max path lengths found by the box method. For each material,
+/// rays are thrown around the one giving the current max path length, by
+/// smearing its position on the bounding box face and its direction.
+/// Iterations continue until the max path lengths change by less than the 
+/// scanner tolerance. The smearing is reduced each time an iteration brings
+/// no significant change, and the refinement stops once it reaches its
+/// minimum value.
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Refining the maximum path lengths (tolerance: " << fScannerTol 
+    << ", rays / material / iteration: " << fNRefineRays << ")";
+
+  const int    kMaxIter  = 100;
+  const double kSmearMax = 0.05;        // fraction of box size / direction
+  const double kSmearMin = kSmearMax/32.;
+
+  // face -> axis normal to the face & sign of the inward direction
+  const int    kFaceAxis[3] = {  1, 0,  2 };
+  const int    kFaceSign[3] = { -1, 1, -1 };
+
+  double halfsize[3] = { fdx, fdy, fdz };
+  double origin  [3] = { fox, foy, foz };
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  unsigned int ntgt = fCurrPDGCodeList->size();
+  vector<double> plprev(ntgt, 0.);
+
+  TLorentzVector x4;
+  TLorentzVector p4;
+
+  double smear = kSmearMax;
+  int    iter  = 0;
+
+  for ( ; iter < kMaxIter; iter++) {
+
+    for (unsigned int itgt = 0; itgt < ntgt; itgt++) {
+      int pdgc = (*fCurrPDGCodeList)[itgt];
+      plprev[itgt] = fCurrMaxPathLengthList->PathLength(pdgc);
+    }
+
+    for (unsigned int itgt = 0; itgt < ntgt; itgt++) {
+      int iface = fMaxPlRayFace[itgt];
+      if ( iface < 0 ) continue; // material not crossed by any ray
+
+      int axis = kFaceAxis[iface];
+
+      for (int iray = 0; iray < fNRefineRays; iray++) {
+        TVector3 pos = fMaxPlRayPos[itgt];
+        TVector3 dir = fMaxPlRayDir[itgt];
+        for (int i = 0; i < 3; i++) {
+          dir[i] += smear * rnd->RndGeom().Gaus();
+          if ( i == axis ) continue;
+          double xmin = origin[i] - halfsize[i];
+          double xmax = origin[i] + halfsize[i];
+          pos[i] += 2*halfsize[i] * smear * rnd->RndGeom().Gaus();
+          pos[i]  = TMath::Min(xmax, TMath::Max(xmin, pos[i]));
+        }
+        // keep the ray pointing into the box
+        if ( kFaceSign[iface]*dir[axis] < 0 ) dir[axis] *= -1;
+        if ( dir.Mag() <= 0 ) continue;
+        dir = dir.Unit();
+
+        this->BoxRay2Master(pos, dir, x4, p4);
+
+        const PathLengthList & pl = this->ComputePathLengths(x4, p4);
+
+        this->UpdateMaxPathLengths(pl, iface, pos, dir);
+      }
+    }
+
+    // largest relative change of the max path lengths in this iteration
+    double change = 0;
+    for (unsigned int itgt = 0; itgt < ntgt; itgt++) {
+      int    pdgc = (*fCurrPDGCodeList)[itgt];
+      double pl   = fCurrMaxPathLengthList->PathLength(pdgc);
+      if ( plprev[itgt] > 0 ) {
+        change = TMath::Max(change, (pl-plprev[itgt])/plprev[itgt]);
+      }
+    }
+
+    LOG("GROOTGeom", pINFO)
+      << "Refinement iteration " << iter << ": smearing = " << smear
+      << ", max relative change = " << change;
+
+    if ( change < fScannerTol ) {
+      if ( smear <= kSmearMin ) break;
+      smear /= 2.;
+    }
+  }
+
+  if ( iter < kMaxIter ) {
+    LOG("GROOTGeom", pNOTICE)
+      << "Max path lengths converged after " << iter+1 << " iterations";
+  } else {
+    LOG("GROOTGeom", pWARN)
+      << "Max path lengths did not converge after " << kMaxIter 
+      << " iterations";
+  }
+}
+
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::BoxRay2Master(
+    const TVector3 & pos, const TVector3 & dir, 
+    TLorentzVector& x4, TLorentzVector& p4)
+{
+/// Transform a box ray from top vol coord & units to master coord & SI units
+
+  TVector3 x(pos);
+  TVector3 d(dir);
+
+  if ( ! fMasterToTopIsIdentity) {
+    this->Top2Master(x);   // transform position (top -> master)
+  }
+  this->Local2SI(x);
+  this->Top2MasterDir(d);  // transform direction (top -> master)
+
+  x4.SetVect(x);
+  p4.SetVect(d.Unit());
+}
+
 //________________________________________________________________________
 double ROOTGeomAnalyzer::ComputePathLengthPDG(
                   const TVector3 & r0, const TVector3 & udir, int pdgc)
@@ -1370,6 +1623,12 @@ double ROOTGeomAnalyzer::ComputePathLengthPDG(
 
   this->SwimOnce(r0,udir);
 
+  int itgt = this->TargetIndex(pdgc);
+  if (itgt < 0) {
+    LOG("GROOTGeom", pERROR) << "Target doesn't exist. Return weight = 0.";
+    return 0;
+  }
+
   double step   = 0;
   double weight = 0;
 
@@ -1386,7 +1645,7 @@ double ROOTGeomAnalyzer::ComputePathLengthPDG(
     mat  = itr->first;
     if ( ! mat ) continue;  // segment outside geometry has no material
     step = itr->second;
-    weight = this->GetWeight(mat,pdgc);
+    weight = this->MaterialWeights(mat)[itgt];
     pl += (step*weight);
   }
 
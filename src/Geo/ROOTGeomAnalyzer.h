@@ -22,6 +22,8 @@
 
 #include <string>
 #include <algorithm>
+#include <map>
+#include <vector>
 
 #include <TGeoManager.h>
 #include <TVector3.h>
@@ -36,6 +38,8 @@ class TGeoElement;
 class TGeoHMatrix;
 
 using std::string;
+using std::map;
+using std::vector;
 
 namespace genie    {
 
@@ -70,7 +74,9 @@ public :
   virtual void SetScannerNRays      (int    nr) { fNRays      = nr; } /* box  scanner */
   virtual void SetScannerNParticles (int    np) { fNParticles = np; } /* flux scanner */
   virtual void SetScannerFlux       (GFluxI* f) { fFlux       = f;  } /* flux scanner */
-  virtual void SetWeightWithDensity (bool   wt) { fDensWeight = wt; }
+  virtual void SetScannerTolerance  (double tl) { fScannerTol = tl; } /* box  scanner: refinement */
+  virtual void SetScannerNRefineRays(int    nr) { fNRefineRays= nr; } /* box  scanner: refinement */
+  virtual void SetWeightWithDensity (bool   wt);
   virtual void SetMixtureWeightsSum (double sum);
   virtual void SetLengthUnits       (double lu);
   virtual void SetDensityUnits      (double du);
@@ -84,6 +90,8 @@ public :
   virtual int           ScannerNPoints    (void) const { return fNPoints;           }
   virtual int           ScannerNRays      (void) const { return fNRays;             }
   virtual int           ScannerNParticles (void) const { return fNParticles;        }
+  virtual double        ScannerTolerance  (void) const { return fScannerTol;        }
+  virtual int           ScannerNRefineRays(void) const { return fNRefineRays;       }
   virtual bool          WeightWithDensity (void) const { return fDensWeight;        }
   virtual double        LengthUnits       (void) const { return fLengthScale;       }
   virtual double        DensityUnits      (void) const { return fDensityScale;      }
@@ -124,9 +132,19 @@ protected:
   virtual double GetWeight               (const TGeoMixture * mixt, int pdgc);
   virtual double GetWeight               (const TGeoMixture * mixt, int ielement, int pdgc);
 
+  virtual void   BuildMaterialWeightTable(void);
+  virtual const vector<double> & 
+                 MaterialWeights         (const TGeoMaterial * mat);
+  virtual int    TargetIndex             (int pdgc) const;
+
   virtual void   MaxPathLengthsFluxMethod(void);
   virtual void   MaxPathLengthsBoxMethod (void);
   virtual bool   GenBoxRay               (int indx, TLorentzVector& x4, TLorentzVector& p4);
+  virtual void   UpdateMaxPathLengths    (const PathLengthList & pl, int iface,
+                                          const TVector3 & pos, const TVector3 & dir);
+  virtual void   RefineMaxPathLengths    (void);
+  virtual void   BoxRay2Master           (const TVector3 & pos, const TVector3 & dir,
+                                          TLorentzVector& x4, TLorentzVector& p4);
 
   virtual double ComputePathLengthPDG    (const TVector3 & r, const TVector3 & udir, int pdgc);
   virtual void   SwimOnce                (const TVector3 & r, const TVector3 & udir);
@@ -145,6 +163,8 @@ protected:
   int              fNPoints;               ///< max path length scanner (box method): points/surface [def:200]
   int              fNRays;                 ///< max path length scanner (box method): rays/point [def:200]
   int              fNParticles;            ///< max path length scanner (flux method): particles in [def:10000]
+  double           fScannerTol;            ///< max path length scanner (box method): refinement tolerance, 0 to disable [def:0]
+  int              fNRefineRays;           ///< max path length scanner (box method): refinement rays/material/iteration [def:1000]
   GFluxI *         fFlux;                  ///< a flux objects that can be used to scan the max path lengths
   bool             fDensWeight;            ///< if true pathlengths are weighted with density [def:true]
   double           fLengthScale;           ///< conversion factor: input geometry length units -> meters
@@ -163,12 +183,26 @@ protected:
   PathSegmentList* fCurrPathSegmentList;   ///< current list of path-segments
   GeomVolSelectorI* fGeomVolSelector;      ///< optional path seg trimmer (owned)
 
+  // weight of each target nucleus (same order as fCurrPDGCodeList) in each
+  // material, in curr geom density units - built once the geometry is loaded
+  // so that the path lengths for all targets are computed in a single pass
+  map<const TGeoMaterial *, vector<double> > fMatWeights;
+  vector<double>   fCurrPlBuffer;          ///< path lengths summed per target (same order as fCurrPDGCodeList)
+
   // used by GenBoxRay to retain history between calls
   TVector3         fGenBoxRayPos;
   TVector3         fGenBoxRayDir;
   int              fiface, fipoint, firay;
   bool             fnewpnt;
   double           fdx, fdy, fdz, fox, foy, foz;  ///< top vol size/origin (top vol units)
+
+  // box rays (top vol coord & units) giving the current max path lengths, 
+  // used for refining the max path lengths (same order as fCurrPDGCodeList)
+  TVector3         fGenBoxRayPosTop;
+  TVector3         fGenBoxRayDirTop;
+  vector<int>      fMaxPlRayFace;
+  vector<TVector3> fMaxPlRayPos;
+  vector<TVector3> fMaxPlRayDir;
   
   // test purposes
   double           fmxddist, fmxdstep;   ///< max errors in pathsegmentlist
@@ -0,0 +1,229 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+         Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+         STFC, Rutherford Appleton Laboratory
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include <TLorentzVector.h>
+#include <TVector3.h>
+#include <TMath.h>
+
+#include "Conventions/Constants.h"
+#include "Conventions/Units.h"
+#include "HadronTransport/INukeHadroData.h"
+#include "HadronTransport/INukeOpticalDepth.h"
+#include "Messenger/Messenger.h"
+#include "Numerical/Spline.h"
+#include "PDG/PDGCodes.h"
+#include "Utils/NuclearUtils.h"
+
+using namespace genie;
+using namespace genie::constants;
+
+//____________________________________________________________________________
+INukeOpticalDepth * INukeOpticalDepth::fInstance = 0;
+//____________________________________________________________________________
+INukeOpticalDepth::INukeOpticalDepth()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+INukeOpticalDepth::~INukeOpticalDepth()
+{
+
+}
+//____________________________________________________________________________
+INukeOpticalDepth * INukeOpticalDepth::Instance()
+{
+  if(fInstance == 0) {
+    LOG("INukeData", pINFO) << "INukeOpticalDepth late initialization";
+    static INukeOpticalDepth::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new INukeOpticalDepth;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+const INukeOpticalDepth::DensityParams_t &
+                                 INukeOpticalDepth::Params(int A) const
+{
+// Density profile parameters for the input mass number, as used in
+// utils::nuclear::Density(). The normalization and max ring size are those
+// of utils::nuclear::DensityWoodsSaxon() and DensityGaus().
+
+  map<int, DensityParams_t>::const_iterator it = fDensityParams.find(A);
+  if(it != fDensityParams.end()) return it->second;
+
+  DensityParams_t par;
+  par.woods_saxon = 
+     utils::nuclear::DensityParams(A, par.radius, par.shape);
+
+  if(par.woods_saxon) {
+    double c = par.radius;
+    double z = par.shape;
+    par.ring_max = 0.75*c;
+    par.norm     = (3./(4.*kPi*TMath::Power(c,3)))*1./(1.+TMath::Power((kPi*z/c),2));
+  }
+  else {
+    double ap  = par.radius;
+    double alf = par.shape;
+    par.ring_max = 0.3*ap;
+    par.norm     = 1./((5.568 + alf*8.353)*TMath::Power(ap,3.));
+  }
+
+  LOG("INukeData", pINFO)
+     << "Tabulated density profile for A = " << A << ": "
+     << (par.woods_saxon ? "Woods-Saxon" : "modified harmonic osc.")
+     << " with R = " << par.radius << " fm, shape = " << par.shape;
+
+  return fDensityParams.insert(
+           map<int, DensityParams_t>::value_type(A, par)).first->second;
+}
+//____________________________________________________________________________
+double INukeOpticalDepth::Density(double r, int A, double ring) const
+{
+  const DensityParams_t & par = this->Params(A);
+
+  ring = TMath::Min(ring, par.ring_max);
+
+  if(par.woods_saxon) {
+    double ceval = par.radius + ring;
+    return par.norm / (1 + TMath::Exp((r-ceval)/par.shape));
+  }
+
+  double aeval = par.radius + ring;
+  double b     = TMath::Power(r/aeval, 2.);
+  return par.norm * (1. + par.shape*b) * TMath::Exp(-b);
+}
+//____________________________________________________________________________
+double INukeOpticalDepth::RingSize(int pdgc, const TLorentzVector & p4,
+                            double A, double nRpi, double nRnuc) const
+{
+// The nucleus has to become larger by const times the de Broglie wavelength
+// -- that is somewhat empirical, but this is what is needed to get piA total
+// cross sections right.
+// The ring size is different for light nuclei (using gaus density) /
+// heavy nuclei (using woods-saxon density).
+// The ring size is different for pions / nucleons.
+
+  bool is_pion    = pdgc == kPdgPiP || pdgc == kPdgPi0 || pdgc == kPdgPiM;
+  bool is_nucleon = pdgc == kPdgProton || pdgc == kPdgNeutron;
+  bool is_kaon    = pdgc == kPdgKP;
+  bool is_gamma   = pdgc == kPdgGamma;
+
+  double momentum = p4.Vect().Mag(); // hadron momentum in GeV
+  double ring = (momentum>0) ? 1.240/momentum : 0; // de-Broglie wavelength
+
+  if(A<=20) { ring /= 2.; }
+
+  if      (is_pion    || is_kaon ) { ring *= nRpi;  }
+  else if (is_nucleon            ) { ring *= nRnuc; }
+  else if (is_gamma              ) { ring = 0.;     }
+
+  return ring;
+}
+//____________________________________________________________________________
+double INukeOpticalDepth::XSecTotal(
+                          int pdgc, double ke, double A, double Z) const
+{
+  // the hadron+nucleon cross section will be evaluated within the range
+  // of the input spline and assumed to be const outside that range
+  //
+  ke = TMath::Max(INukeHadroData::fMinKinEnergy,   ke);
+  ke = TMath::Min(INukeHadroData::fMaxKinEnergyHN, ke);
+
+  double sigtot = 0;
+  double ppcnt = (double) Z/ (double) A; // % of protons remaining
+  INukeHadroData * fHadroData = INukeHadroData::Instance();
+
+  if (pdgc == kPdgPiP)
+    { sigtot = fHadroData -> XSecPipp_Tot() -> Evaluate(ke)*ppcnt;
+      sigtot+= fHadroData -> XSecPipn_Tot() -> Evaluate(ke)*(1-ppcnt);}
+  else if (pdgc == kPdgPi0)
+    { sigtot = fHadroData -> XSecPi0p_Tot() -> Evaluate(ke)*ppcnt;
+      sigtot+= fHadroData -> XSecPi0n_Tot() -> Evaluate(ke)*(1-ppcnt);}
+  else if (pdgc == kPdgPiM)
+    { sigtot = fHadroData -> XSecPipn_Tot() -> Evaluate(ke)*ppcnt;
+      sigtot+= fHadroData -> XSecPipp_Tot() -> Evaluate(ke)*(1-ppcnt);}
+  else if (pdgc == kPdgProton)
+    { sigtot = fHadroData -> XSecPp_Tot()   -> Evaluate(ke)*ppcnt;
+      sigtot+= fHadroData -> XSecPn_Tot()   -> Evaluate(ke)*(1-ppcnt);}
+  else if (pdgc == kPdgNeutron)
+    { sigtot = fHadroData -> XSecPn_Tot()   -> Evaluate(ke)*ppcnt;
+      sigtot+= fHadroData -> XSecNn_Tot()   -> Evaluate(ke)*(1-ppcnt);}
+  else if (pdgc == kPdgKP)
+    { sigtot = fHadroData -> XSecKpN_Tot()  -> Evaluate(ke);
+      sigtot*=1.2;}
+  else if (pdgc == kPdgGamma)
+    { sigtot = fHadroData -> XSecGamp_fs()  -> Evaluate(ke)*ppcnt;
+      sigtot+= fHadroData -> XSecGamn_fs()  -> Evaluate(ke)*(1-ppcnt);}
+  else {
+     return -1;
+  }
+
+  // the xsection splines in INukeHadroData return the hadron x-section in
+  // mb -> convert to fm^2
+  sigtot *= (units::mb / units::fm2);
+
+  return sigtot;
+}
+//____________________________________________________________________________
+double INukeOpticalDepth::OpticalDepth(
+   int pdgc, const TLorentzVector & x4, const TLorentzVector & p4,
+   double A, double Z, double nRpi, double nRnuc, double Rmax,
+   double step) const
+{
+// Inputs
+//  pdgc : Hadron PDG code
+//  x4   : Hadron 4-position in the nucleus coordinate system (units: fm)
+//  p4   : Hadron 4-momentum (units: GeV)
+//  A,Z  : Nucleus atomic mass and atomic number
+//  nRpi : Controls the pion ring size in terms of de-Broglie wavelengths
+//  nRnuc: Controls the nuclepn ring size in terms of de-Broglie wavelengths
+//  Rmax : Distance from the nucleus center where tracking stops (units: fm)
+//  step : Step size (units: fm)
+
+  double ke     = (p4.Energy() - p4.M()) / units::MeV; // kinetic energy in MeV
+  double sigtot = this->XSecTotal(pdgc, ke, A, Z);
+  if(sigtot < 0) return -1.; // hadron not handled by Intranuke
+
+  double ring   = this->RingSize(pdgc, p4, A, nRpi, nRnuc);
+
+  // chord: r(s)^2 = b^2 + (z0+s)^2, where b is the impact parameter and
+  // z0 the position along the hadron direction
+  TVector3 x3  = x4.Vect();
+  TVector3 dr3 = p4.Vect().Unit(); // unit vector along its direction
+  if(dr3.Mag2() <= 0) return 0.; // at rest: no path to integrate over
+
+  double z0 = x3.Dot(dr3);
+  double b2 = TMath::Max(0., x3.Mag2() - z0*z0);
+
+  double depth = 0;
+  double rnow  = x3.Mag();
+  for(int istep = 1; rnow <= (Rmax+step); istep++) {
+    double z = z0 + istep*step;
+    rnow = TMath::Sqrt(b2 + z*z);
+
+    // 1/mean free path
+    double rho    = A * this->Density(rnow, (int) A, ring);
+    double invmfp = rho * sigtot;
+    // infinite mean free path: no interaction at this step
+    if(invmfp <= 0) continue;
+
+    depth += step * invmfp;
+  }
+
+  return depth;
+}
+//____________________________________________________________________________
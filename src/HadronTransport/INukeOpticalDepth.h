@@ -0,0 +1,107 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::INukeOpticalDepth
+
+\brief    Computes the optical depth (the integral of density x cross section)
+          seen by a hadron travelling along a straight chord through the
+          nucleus, and the hadron mean free path.
+          This is the common engine behind the Intranuke step generation
+          (utils::intranuke::MeanFreePath()) and the hadron survival
+          probability used for FSI reweighting (ProbSurvival()).
+
+          Along a chord the hadron momentum does not change, so the total
+          hadron+nucleon cross section (2 INukeHadroData spline evaluations)
+          is computed only once per chord rather than at every step.
+          The nuclear density shape parameters and normalization are
+          tabulated per mass number (A) the first time that nucleus is met,
+          so that each step only costs a single exponential.
+          The chord is parametrized by its impact parameter and longitudinal
+          position so that no 3-vector arithmetic is needed while stepping.
+          The stepping (0.05 fm steps) and the density / cross section
+          calculations are those of the original per-step implementation.
+
+\author   The GENIE Collaboration
+          Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+          STFC, Rutherford Appleton Laboratory
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _INTRANUKE_OPTICAL_DEPTH_H_
+#define _INTRANUKE_OPTICAL_DEPTH_H_
+
+#include <map>
+
+class TLorentzVector;
+
+using std::map;
+
+namespace genie {
+
+class INukeOpticalDepth
+{
+public:
+  static INukeOpticalDepth * Instance (void);
+
+  //! Nuclear density (fm^-3, normalized to 1) as in utils::nuclear::Density()
+  double Density    (double r, int A, double ring = 0.) const;
+
+  //! Ring size (fm) added to the nuclear radius for the input hadron
+  double RingSize   (int pdgc, const TLorentzVector & p4, double A,
+                     double nRpi, double nRnuc) const;
+
+  //! Total hadron+nucleon cross section (fm^2) averaged over the nucleus
+  //! protons and neutrons, for the input kinetic energy (MeV).
+  //! Returns -1 for hadrons not handled by Intranuke.
+  double XSecTotal  (int pdgc, double ke, double A, double Z) const;
+
+  //! Optical depth (sum of step x density x cross section) accumulated by
+  //! a hadron stepping from x4 along p4 until it is further than Rmax from
+  //! the nucleus center. Steps with an infinite mean free path (zero
+  //! density x cross section) do not contribute. Returns -1 for hadrons
+  //! not handled by Intranuke.
+  double OpticalDepth (int pdgc, const TLorentzVector & x4,
+                       const TLorentzVector & p4, double A, double Z,
+                       double nRpi, double nRnuc, double Rmax,
+                       double step = 0.05) const;
+
+private:
+  INukeOpticalDepth();
+  INukeOpticalDepth(const INukeOpticalDepth & od);
+ ~INukeOpticalDepth();
+
+  // density profile parameters for a given mass number
+  typedef struct EDensityParams {
+    bool   woods_saxon; ///< Woods-Saxon (true) or modified harmonic osc. (false) shape
+    double radius;      ///< c (Woods-Saxon) or a (harmonic osc.) (fm)
+    double shape;       ///< z (Woods-Saxon) or alpha (harmonic osc.)
+    double ring_max;    ///< max ring size (fm)
+    double norm;        ///< normalization (fm^-3)
+  } DensityParams_t;
+
+  const DensityParams_t & Params (int A) const;
+
+  static INukeOpticalDepth * fInstance;
+
+  mutable map<int, DensityParams_t> fDensityParams; ///< A -> density profile parameters
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (INukeOpticalDepth::fInstance !=0) {
+            delete INukeOpticalDepth::fInstance;
+            INukeOpticalDepth::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+#endif //_INTRANUKE_OPTICAL_DEPTH_H_
@@ -48,6 +48,7 @@
 #include "HadronTransport/INukeException.h"
 #include "HadronTransport/INukeUtils.h"
 #include "HadronTransport/INukeHadroData.h"
+#include "HadronTransport/INukeOpticalDepth.h"
 #include "Messenger/Messenger.h"
 #include "Numerical/RandomGen.h"
 #include "Numerical/Spline.h"
@@ -57,6 +58,7 @@
 #include "PDG/PDGCodeList.h"
 #include "PDG/PDGUtils.h"
 #include "Registry/Registry.h"
+#include "Utils/NuclearDensityTable.h"
 #include "Utils/NuclearUtils.h"
 #include "Utils/PrintUtils.h"
 
@@ -87,69 +89,23 @@ double genie::utils::intranuke::MeanFreePath(
   bool is_gamma   = pdgc == kPdgGamma;
 
   if(!is_pion && !is_nucleon && !is_kaon && !is_gamma) return 0.;
+
+  INukeOpticalDepth * od = INukeOpticalDepth::Instance();
         
   // before getting the nuclear density at the current position
   // check whether the nucleus has to become larger by const times the
-  // de Broglie wavelength -- that is somewhat empirical, but this
-  // is what is needed to get piA total cross sections right.
-  // The ring size is different for light nuclei (using gaus density) /
-  // heavy nuclei (using woods-saxon density).
-  // The ring size is different for pions / nucleons.
+  // de Broglie wavelength (see INukeOpticalDepth::RingSize())
   //
-  double momentum = p4.Vect().Mag(); // hadron momentum in GeV
-  double ring = (momentum>0) ? 1.240/momentum : 0; // de-Broglie wavelength
- 
-  if(A<=20) { ring /= 2.; }
- 
-  if      (is_pion    || is_kaon ) { ring *= nRpi;  }
-  else if (is_nucleon            ) { ring *= nRnuc; }
-  else if (is_gamma              ) { ring = 0.;     }
+  double ring = od->RingSize(pdgc,p4,A,nRpi,nRnuc);
 
   // get the nuclear density at the current position
   double rnow = x4.Vect().Mag(); 
-  double rho  = A * utils::nuclear::Density(rnow,(int) A,ring);
+  double rho  = A * od->Density(rnow,(int) A,ring);
 
-  // the hadron+nucleon cross section will be evaluated within the range
-  // of the input spline and assumed to be const outside that range
-  //
-  double ke = (p4.Energy() - p4.M()) / units::MeV;  // kinetic energy in MeV
-  ke = TMath::Max(INukeHadroData::fMinKinEnergy,   ke);
-  ke = TMath::Min(INukeHadroData::fMaxKinEnergyHN, ke);
-
-  // get total xsection for the incident hadron at its current
+  // get total xsection (in fm^2) for the incident hadron at its current
   // kinetic energy
-  double sigtot = 0;
-  double ppcnt = (double) Z/ (double) A; // % of protons remaining
-  INukeHadroData * fHadroData = INukeHadroData::Instance();
-
-  if (pdgc == kPdgPiP)
-    { sigtot = fHadroData -> XSecPipp_Tot() -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData -> XSecPipn_Tot() -> Evaluate(ke)*(1-ppcnt);}
-  else if (pdgc == kPdgPi0)
-    { sigtot = fHadroData -> XSecPi0p_Tot() -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData -> XSecPi0n_Tot() -> Evaluate(ke)*(1-ppcnt);}
-  else if (pdgc == kPdgPiM)
-    { sigtot = fHadroData -> XSecPipn_Tot() -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData -> XSecPipp_Tot() -> Evaluate(ke)*(1-ppcnt);}
-  else if (pdgc == kPdgProton)
-    { sigtot = fHadroData -> XSecPp_Tot()   -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData -> XSecPn_Tot()   -> Evaluate(ke)*(1-ppcnt);}
-  else if (pdgc == kPdgNeutron)
-    { sigtot = fHadroData -> XSecPn_Tot()   -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData -> XSecNn_Tot()   -> Evaluate(ke)*(1-ppcnt);}
-  else if (pdgc == kPdgKP)
-    { sigtot = fHadroData -> XSecKpN_Tot()  -> Evaluate(ke);
-      sigtot*=1.2;}
-  else if (pdgc == kPdgGamma)
-    { sigtot = fHadroData -> XSecGamp_fs()  -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData -> XSecGamn_fs()  -> Evaluate(ke)*(1-ppcnt);}
-  else {
-     return 0;
-  }
-
-  // the xsection splines in INukeHadroData return the hadron x-section in
-  // mb -> convert to fm^2
-  sigtot *= (units::mb / units::fm2);
+  double ke = (p4.Energy() - p4.M()) / units::MeV;  // kinetic energy in MeV
+  double sigtot = od->XSecTotal(pdgc,ke,A,Z);
 
   // compute the mean free path
   double lamda = 1. / (rho * sigtot);
@@ -187,7 +143,7 @@ double genie::utils::intranuke::MeanFreePath_Delta(
         
   // get the nuclear density at the current position
   double rnow = x4.Vect().Mag(); 
-  double rho  = A * utils::nuclear::Density(rnow,(int) A);
+  double rho  = A * NuclearDensityTable::Instance()->Density(rnow,(int) A);
 
   // the Delta+N->N+N cross section will be evaluated within the range
   // of the input spline and assumed to be const outside that range
@@ -233,14 +189,6 @@ double genie::utils::intranuke::ProbSurvival(
 //      nuclear radius. Def: 3
 //  R0: R0 in R=R0*A^1/3 (units:fm). Def. 1.4
 
-   double prob = 1.0;
-
-   double step = 0.05; // fermi
-   double R    = NR * R0 * TMath::Power(A, 1./3.);
-
-   TVector3 dr3 = p4.Vect().Unit();  // unit vector along its direction
-   TLorentzVector dr4(dr3,0);
-
    LOG("INukeUtils", pDEBUG) 
      << "Calculating survival probability for hadron with PDG code = " << pdgc
      << " and momentum = " << p4.P() << " GeV";
@@ -249,31 +197,44 @@ double genie::utils::intranuke::ProbSurvival(
      << ", nRpi = " << nRpi << ", nRnuc = " << nRnuc << ", NR = " << NR
      << ", R0 = " << R0 << " fm";
 
-   TLorentzVector x4_curr(x4); // current position
+   double depth = genie::utils::intranuke::OpticalDepth(
+                                   pdgc,x4,p4,A,Z,nRpi,nRnuc,NR,R0);
+   double prob  = genie::utils::intranuke::ProbSurvival(depth,mfp_scale_factor);
 
-   while(1) {
-     double rnow  = x4_curr.Vect().Mag();
-     if (rnow > (R+step)) break;
+   LOG("INukeUtils", pDEBUG) << "Psurv = " << prob;
 
-     x4_curr += (step*dr4);
-     rnow = x4_curr.Vect().Mag();
-     double mfp = 
-       genie::utils::intranuke::MeanFreePath(pdgc,x4_curr,p4,A,Z,nRpi,nRnuc);
-     double mfp_twk = mfp * mfp_scale_factor;
+   return prob;
+}
+//____________________________________________________________________________
+double genie::utils::intranuke::ProbSurvival(
+                              double optical_depth, double mfp_scale_factor)
+{
+// Calculate the survival probability for a hadron inside a nucleus from the
+// optical depth along its path (see OpticalDepth()), with the mean free path
+// tweaked by mfp_scale_factor (mfp -> mfp*scale). A negative optical depth 
+// flags a hadron not handled by Intranuke, which never survives (as it has
+// a zero mean free path, see MeanFreePath()).
 
-     double dprob = (mfp_twk>0) ? TMath::Exp(-step/mfp_twk) : 0.;
-     prob*=dprob;
-/*
-     LOG("INukeUtils", pDEBUG) 
-       << "+ step size = " << step << " fm, |r| = " << rnow << " fm, "
-       << "mfp = " << mfp_twk << "fm (nominal mfp = " << mfp << " fm): "
-       << "dPsurv = " << dprob << ", current Psurv = " << prob;
-*/
-   }
+   if(optical_depth <  0) return 0.;
+   if(optical_depth == 0) return 1.;
 
-   LOG("INukeUtils", pDEBUG) << "Psurv = " << prob;
+   return TMath::Exp(-optical_depth/mfp_scale_factor);
+}
+//____________________________________________________________________________
+double genie::utils::intranuke::OpticalDepth(
+  int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A, 
+  double Z, double nRpi, double nRnuc, double NR, double R0)
+{
+// Calculate the optical depth (path integral of 1/mean free path) seen by
+// a hadron tracked, in 0.05 fm steps, from its current position up to NR
+// nuclear radii away from the nucleus center.
+// See ProbSurvival() for a description of inputs.
 
-   return prob;
+   double step = 0.05; // fermi
+   double R    = NR * R0 * TMath::Power(A, 1./3.);
+
+   return INukeOpticalDepth::Instance()->OpticalDepth(
+                                      pdgc,x4,p4,A,Z,nRpi,nRnuc,R,step);
 }
 //____________________________________________________________________________
 double genie::utils::intranuke::Dist2Exit(
@@ -48,6 +48,14 @@ namespace intranuke
     double Z, double mfp_scale_factor=1.0,
     double nRpi=0.5, double nRnuc=1.0, double NR=3, double R0=1.4);
 
+  //! Hadron survival probability for the input optical depth
+  double ProbSurvival(double optical_depth, double mfp_scale_factor=1.0);
+
+  //! Optical depth (integral of 1/mean free path) up to NR nuclear radii
+  double OpticalDepth(
+    int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A,
+    double Z, double nRpi=0.5, double nRnuc=1.0, double NR=3, double R0=1.4);
+
   //! Mean free path (pions, nucleons)
   double MeanFreePath(
     int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A,
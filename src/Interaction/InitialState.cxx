@@ -371,6 +371,23 @@ string InitialState::AsString(void) const
   return init_state.str();
 }
 //___________________________________________________________________________
+ULong64_t InitialState::Code(void) const
+{
+  return InitialState::Code(this->Tgt().Pdg(), this->ProbePdg());
+}
+//___________________________________________________________________________
+ULong64_t InitialState::Code(int tgt_pdgc, int probe_pdgc)
+{
+// Packs the target PDG code in the upper and the probe PDG code in the
+// lower 32 bits. Unlike AsString(), no memory is allocated so it can be
+// called for every flux neutrino and every material.
+
+  ULong64_t code = (ULong64_t) (UInt_t) tgt_pdgc;
+  code = (code << 32) | (ULong64_t) (UInt_t) probe_pdgc;
+
+  return code;
+}
+//___________________________________________________________________________
 void InitialState::Print(ostream & stream) const
 {
   stream << "[-] [Init-State] " << endl;
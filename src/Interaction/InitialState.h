@@ -75,6 +75,11 @@ public:
   string AsString (void) const;
   void   Print    (ostream & stream) const;
 
+  //-- Compact integer code (probe & target PDG codes, as in AsString()).
+  //-- Cheap to build and compare; used as a key on the event loop hot path.
+  ULong64_t        Code     (void) const;
+  static ULong64_t Code     (int tgt_pdgc, int probe_pdgc);
+
   //-- Overloaded operators
   bool             operator == (const InitialState & i) const;             ///< equal?
   InitialState &   operator =  (const InitialState & i);                   ///< copy
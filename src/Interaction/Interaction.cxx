@@ -74,6 +74,19 @@ using namespace genie::constants;
 using std::endl;
 using std::ostringstream;
 
+//___________________________________________________________________________
+namespace {
+ // hash-combine an integer field into an interaction code
+ inline ULong64_t MixCode(ULong64_t code, int field)
+ {
+   ULong64_t z = code ^ ((ULong64_t) (UInt_t) field);
+   z += 0x9E3779B97F4A7C15ULL;
+   z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+   z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+   return z ^ (z >> 31);
+ }
+}
+
 ClassImp(Interaction)
 
 //____________________________________________________________________________
@@ -311,6 +324,37 @@ string Interaction::AsString(void) const
   return interaction.str();
 }
 //___________________________________________________________________________
+ULong64_t Interaction::Code(void) const
+{
+// Hash all the fields used in AsString() (and only those, with the same
+// conditions) into a 64-bit code. No memory is allocated.
+
+  const Target & tgt = fInitialState->Tgt();
+
+  ULong64_t code = fInitialState->Code();
+
+  code = MixCode(code, tgt.HitNucIsSet() ? tgt.HitNucPdg() : 0);
+  code = MixCode(code, tgt.HitQrkIsSet() ? tgt.HitQrkPdg() : 0);
+  code = MixCode(code, tgt.HitQrkIsSet() && tgt.HitSeaQrk() ? 1 : 0);
+
+  code = MixCode(code, (int) fProcInfo->InteractionTypeId());
+  code = MixCode(code, (int) fProcInfo->ScatteringTypeId());
+
+  const XclsTag & xcls = *fExclusiveTag;
+
+  code = MixCode(code, xcls.IsCharmEvent() ? 1 : 0);
+  code = MixCode(code, xcls.IsCharmEvent() ? xcls.CharmHadronPdg() : 0);
+  code = MixCode(code, xcls.NProtons());
+  code = MixCode(code, xcls.NNeutrons());
+  code = MixCode(code, xcls.NPiPlus());
+  code = MixCode(code, xcls.NPiMinus());
+  code = MixCode(code, xcls.NPi0());
+  code = MixCode(code, xcls.KnownResonance() ? (int) xcls.Resonance() : -1);
+  code = MixCode(code, xcls.DecayMode());
+
+  return code;
+}
+//___________________________________________________________________________
 void Interaction::Print(ostream & stream) const
 {
   const string line(110, '-');
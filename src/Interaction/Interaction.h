@@ -87,6 +87,11 @@ public:
   string AsString (void) const;
   void   Print    (ostream & stream) const;
 
+  // Compact hashed code of everything packed in AsString(). Interactions
+  // with the same AsString() have the same Code(). Used as a lookup key on
+  // the event generation hot path, where building AsString() is too costly
+  ULong64_t Code  (void) const;
+
   // Overloaded operators
   Interaction &    operator =  (const Interaction & i);                   ///< copy
   friend ostream & operator << (ostream & stream, const Interaction & i); ///< print
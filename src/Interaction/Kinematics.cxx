@@ -55,10 +55,11 @@ TObject()
 //____________________________________________________________________________
 Kinematics::Kinematics(TRootIOCtor*) :
 TObject(),
+fKVSetMask(0),
 fP4Fsl(0), 
 fP4HadSyst(0)
 {
-
+  for(int i = 0; i < kNKineVar; i++) fKVValue[i] = 0.;
 }
 //____________________________________________________________________________
 Kinematics::~Kinematics()
@@ -68,7 +69,8 @@ Kinematics::~Kinematics()
 //____________________________________________________________________________
 void Kinematics::Init(void)
 {
-  fKV.clear();
+  for(int i = 0; i < kNKineVar; i++) fKVValue[i] = 0.;
+  fKVSetMask = 0;
 
   fP4Fsl     = new TLorentzVector;
   fP4HadSyst = new TLorentzVector; 
@@ -76,7 +78,7 @@ void Kinematics::Init(void)
 //____________________________________________________________________________
 void Kinematics::CleanUp(void)
 {
-  fKV.clear();
+  fKVSetMask = 0;
 
   delete fP4Fsl;
   delete fP4HadSyst; 
@@ -84,7 +86,7 @@ void Kinematics::CleanUp(void)
 //____________________________________________________________________________
 void Kinematics::Reset(void)
 {
-  fKV.clear();
+  fKVSetMask = 0;
 
   this->SetFSLeptonP4 (0,0,0,0);
   this->SetHadSystP4  (0,0,0,0);
@@ -92,15 +94,8 @@ void Kinematics::Reset(void)
 //____________________________________________________________________________
 void Kinematics::Copy(const Kinematics & kinematics)
 {
-  this->Reset();
-
-  map<KineVar_t, double>::const_iterator iter;
-
-  for(iter = kinematics.fKV.begin(); iter != kinematics.fKV.end(); ++iter) {
-    KineVar_t kv  = iter->first;
-    double    val = iter->second;
-    this->SetKV(kv,val);
-  }
+  for(int i = 0; i < kNKineVar; i++) fKVValue[i] = kinematics.fKVValue[i];
+  fKVSetMask = kinematics.fKVSetMask;
 
   this->SetFSLeptonP4 (*kinematics.fP4Fsl);
   this->SetHadSystP4  (*kinematics.fP4HadSyst);
@@ -326,15 +321,15 @@ void Kinematics::SetHadSystP4(double px, double py, double pz, double E)
 //____________________________________________________________________________
 bool Kinematics::KVSet(KineVar_t kv) const
 {
-  if(fKV.count(kv) == 1) return true;
-  else return false;
+  if(kv <= kKVNull || kv >= kNKineVar) return false;
+
+  return (fKVSetMask & (1u << kv)) != 0;
 }
 //____________________________________________________________________________
 double Kinematics::GetKV(KineVar_t kv) const
 {
   if(this->KVSet(kv)) {
-     map<KineVar_t, double>::const_iterator iter = fKV.find(kv);
-     return iter->second;
+     return fKVValue[kv];
   } else {
     LOG("Interaction", pWARN)
         << "Kinematic variable: " << KineVar::AsString(kv) << " was not set";
@@ -347,54 +342,44 @@ void Kinematics::SetKV(KineVar_t kv, double value)
   LOG("Interaction", pDEBUG)
             << "Setting " << KineVar::AsString(kv) << " to " << value;
 
-  if(this->KVSet(kv)) {
-     fKV[kv] = value;
-  } else {
-     fKV.insert( map<KineVar_t, double>::value_type(kv,value) );
+  if(kv <= kKVNull || kv >= kNKineVar) {
+     LOG("Interaction", pWARN)
+        << "Can not set kinematic variable: " << KineVar::AsString(kv);
+     return;
   }
+  fKVValue[kv] = value;
+  fKVSetMask  |= (1u << kv);
 }
 //____________________________________________________________________________
 void Kinematics::ClearRunningValues(void)
 {
 // clear the running values (leave the selected ones)
 //
-  fKV.erase( kKVx  );
-  fKV.erase( kKVy  );
-  fKV.erase( kKVQ2 );
-  fKV.erase( kKVq2 );
-  fKV.erase( kKVW  );
-  fKV.erase( kKVt  );
+  fKVSetMask &= ~( (1u << kKVx ) | (1u << kKVy ) |
+                   (1u << kKVQ2) | (1u << kKVq2) |
+                   (1u << kKVW ) | (1u << kKVt ) );
 }
 //____________________________________________________________________________
 void Kinematics::UseSelectedKinematics(void)
 {
 // copy the selected kinematics into the running ones
 //
-  map<KineVar_t, double>::const_iterator iter;
-  iter = fKV.find(kKVSelx);
-  if(iter != fKV.end()) this->Setx(iter->second);
-  iter = fKV.find(kKVSely);
-  if(iter != fKV.end()) this->Sety(iter->second);
-  iter = fKV.find(kKVSelQ2);
-  if(iter != fKV.end()) this->SetQ2(iter->second);
-  iter = fKV.find(kKVSelq2);
-  if(iter != fKV.end()) this->Setq2(iter->second);
-  iter = fKV.find(kKVSelW);
-  if(iter != fKV.end()) this->SetW(iter->second);
-  iter = fKV.find(kKVSelt);
-  if(iter != fKV.end()) this->Sett(iter->second);
+  if(this->KVSet(kKVSelx )) this->Setx (fKVValue[kKVSelx ]);
+  if(this->KVSet(kKVSely )) this->Sety (fKVValue[kKVSely ]);
+  if(this->KVSet(kKVSelQ2)) this->SetQ2(fKVValue[kKVSelQ2]);
+  if(this->KVSet(kKVSelq2)) this->Setq2(fKVValue[kKVSelq2]);
+  if(this->KVSet(kKVSelW )) this->SetW (fKVValue[kKVSelW ]);
+  if(this->KVSet(kKVSelt )) this->Sett (fKVValue[kKVSelt ]);
 }
 //____________________________________________________________________________
 void Kinematics::Print(ostream & stream) const
 {
   stream << "[-] [Kinematics]" << endl;
 
-  map<KineVar_t, double>::const_iterator iter;
-
-  for(iter = fKV.begin(); iter != fKV.end(); ++iter) {
-    KineVar_t kv  = iter->first;
-    double    val = iter->second;
-    stream << " |--> " << KineVar::AsString(kv) << " = " << val << endl;
+  for(int i = 0; i < kNKineVar; i++) {
+    KineVar_t kv = (KineVar_t) i;
+    if(!this->KVSet(kv)) continue;
+    stream << " |--> " << KineVar::AsString(kv) << " = " << fKVValue[kv] << endl;
   }
 }
 //____________________________________________________________________________
@@ -5,6 +5,12 @@
 
 \brief    Generated/set kinematical variables for an event
 
+          The kinematic variables are stored in a fixed-size array indexed
+          by KineVar_t, with a bit mask flagging which ones are set, so that
+          getting / setting / copying them needs no memory allocation.
+          (Versions <= 1 of this class stored them in a map<KineVar_t,double>;
+          those are converted on read by a schema evolution rule in LinkDef.h)
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           STFC, Rutherford Appleton Laboratory
 
@@ -94,11 +100,12 @@ private:
 
   //-- Private data members
 
-  map<KineVar_t, double> fKV;        ///< selected kinematics
-  TLorentzVector *       fP4Fsl;     ///< generated final state primary lepton 4-p  (LAB)
-  TLorentzVector *       fP4HadSyst; ///< generated final state hadronic system 4-p (LAB)
+  Double_t         fKVValue[kNKineVar]; ///< running & selected kinematics, indexed by KineVar_t
+  UInt_t           fKVSetMask;          ///< bit kv is on if fKVValue[kv] is set
+  TLorentzVector * fP4Fsl;              ///< generated final state primary lepton 4-p  (LAB)
+  TLorentzVector * fP4HadSyst;          ///< generated final state hadronic system 4-p (LAB)
 
-ClassDef(Kinematics,1)
+ClassDef(Kinematics,2)
 };
 
 }       // genie namespace
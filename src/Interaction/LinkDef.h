@@ -11,9 +11,25 @@
 #pragma link C++ class genie::Target;
 #pragma link C++ class genie::ProcessInfo;
 #pragma link C++ class genie::Kinematics+;
+#pragma link C++ class map<genie::KineVar_t,double>+;
 #pragma link C++ class genie::XclsTag;
 #pragma link C++ class genie::KPhaseSpace;
 
 #pragma link C++ ioctortype TRootIOCtor;
 
+// Kinematics versions <= 1 stored the kinematic variables in a map
+#pragma read sourceClass="genie::Kinematics" targetClass="genie::Kinematics" \
+  version="[-1]" source="map<genie::KineVar_t,double> fKV" \
+  target="fKVValue,fKVSetMask" \
+  code="{ fKVSetMask = 0; \
+          for(int i = 0; i < genie::kNKineVar; i++) fKVValue[i] = 0.; \
+          std::map<genie::KineVar_t,double>::const_iterator it; \
+          for(it = onfile.fKV.begin(); it != onfile.fKV.end(); ++it) { \
+            int kv = (int) it->first; \
+            if(kv <= genie::kKVNull || kv >= genie::kNKineVar) continue; \
+            fKVValue[kv] = it->second; \
+            fKVSetMask |= (1u << kv); \
+          } \
+        }"
+
 #endif
@@ -323,7 +323,7 @@ void MECGenerator::RecoilNucleonCluster(GHepRecord * event) const
   // get di-nucleon cluster & its 4-momentum
   GHepParticle * nucleon_cluster = event->HitNucleon();
   assert(nucleon_cluster);
-  TLorentzVector p4cluster(*nucleon_cluster->GetP4());
+  TLorentzVector p4cluster(*nucleon_cluster->P4());
 
   // get neutrino & its 4-momentum
   GHepParticle * neutrino = event->Probe();
@@ -411,53 +411,21 @@ void MECGenerator::DecayNucleonCluster(GHepRecord * event) const
      throw exception;
   }
 
-  // Get the maximum weight
-  double wmax = -1;
-  for(int i=0; i<200; i++) {
-     double w = fPhaseSpaceGenerator.Generate();   
-     wmax = TMath::Max(wmax,w);
-  }
-  assert(wmax>0);
-  wmax *= 2;
-
-  LOG("MEC", pNOTICE) 
-     << "Max phase space gen. weight = " << wmax;
-
+  // Generate an unweighted decay, using the tabulated max weight
   RandomGen * rnd = RandomGen::Instance();
-  bool accept_decay=false;
-  unsigned int itry=0;
-  while(!accept_decay) 
-  {
-     itry++;
-
-     if(itry > controls::kMaxUnweightDecayIterations) {
-       // report, clean-up and return
-       LOG("MEC", pWARN) 
-           << "Couldn't generate an unweighted phase space decay after " 
-           << itry << " attempts";
-       // clean up
-       delete [] mass;
-       delete p4d;
-       delete v4d;
-       // throw exception
-       genie::exceptions::EVGThreadException exception;
-       exception.SetReason("Couldn't select decay after N attempts");
-       exception.SwitchOnFastForward();
-       throw exception;
-     }
-     double w  = fPhaseSpaceGenerator.Generate();   
-     if(w > wmax) {
-        LOG("MEC", pWARN) 
-           << "Decay weight = " << w << " > max decay weight = " << wmax;
-     }
-     double gw = wmax * rnd->RndDec().Rndm();
-     accept_decay = (gw<=w);
-
-     LOG("MEC", pINFO) 
-        << "Decay weight = " << w << " / R = " << gw 
-        << " - accepted: " << accept_decay;
-
-  } //!accept_decay
+  bool accept_decay = 
+     fPhaseSpaceGenerator.GenerateUnweighted(rnd->RndDec(), 2.);
+  if(!accept_decay) {
+     // clean up
+     delete [] mass;
+     delete p4d;
+     delete v4d;
+     // throw exception
+     genie::exceptions::EVGThreadException exception;
+     exception.SetReason("Couldn't select decay after N attempts");
+     exception.SwitchOnFastForward();
+     throw exception;
+  }
 
   // Insert the decay products in the event record
   TLorentzVector v4(*v4d); 
@@ -22,10 +22,9 @@
 #ifndef _MEC_GENERATOR_H_
 #define _MEC_GENERATOR_H_
 
-#include <TGenPhaseSpace.h>
-
 #include "EVGCore/EventRecordVisitorI.h"
 #include "PDG/PDGCodeList.h"
+#include "Utils/NBodyPhaseSpace.h"
 
 namespace genie {
 
@@ -60,7 +59,7 @@ private:
   PDGCodeList NucleonClusterConstituents  (int pdgc)           const;
   
   mutable const XSecAlgorithmI * fXSecModel;
-  mutable TGenPhaseSpace         fPhaseSpaceGenerator;
+  mutable NBodyPhaseSpace        fPhaseSpaceGenerator;
   const NuclearModelI *          fNuclModel;
 };
 
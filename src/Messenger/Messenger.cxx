@@ -33,6 +33,7 @@
 #include <iostream>
 #include <vector>
 #include <iomanip>
+#include <cstring>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
@@ -102,19 +103,58 @@ Messenger * Messenger::Instance()
 //____________________________________________________________________________
 log4cpp::Category & Messenger::operator () (const char * stream)
 {
-  log4cpp::Category & MSG = log4cpp::Category::getInstance(stream);
+  return this->Category(stream);
+}
+//____________________________________________________________________________
+bool Messenger::IsPriorityEnabled(
+   const char * stream, log4cpp::Priority::Value priority)
+{
+// Used by MESG_ENABLED.
+// The category priority is not cached as it may change at any time.
 
-  return MSG;
+  return this->Category(stream).isPriorityEnabled(priority);
+}
+//____________________________________________________________________________
+log4cpp::Category * Messenger::EnabledCategory(
+   const char * stream, log4cpp::Priority::Value priority)
+{
+// Called by the message macros (through MessengerGate) before any part of
+// the message is built. Returns the category of the input stream, or 0 if
+// a message with the input priority would be filtered.
+
+  log4cpp::Category & cat = this->Category(stream);
+
+  return (cat.isPriorityEnabled(priority)) ? &cat : 0;
 }
 //____________________________________________________________________________
 void Messenger::SetPriorityLevel(
    const char * stream, log4cpp::Priority::Value priority)
 {
-  log4cpp::Category & MSG = log4cpp::Category::getInstance(stream);
+  log4cpp::Category & MSG = this->Category(stream);
 
   MSG.setPriority(priority);
 }
 //____________________________________________________________________________
+log4cpp::Category & Messenger::Category(const char * stream)
+{
+// Look-up the log4cpp category for the input stream name. The address of 
+// the input name is used as a key (so that no std::string is built for the
+// very common case of a string literal) but the category name is verified
+// as the input name may well be a transient buffer.
+
+  std::map<const char *, log4cpp::Category *>::const_iterator 
+                                       cat_iter = fCategories.find(stream);
+  if(cat_iter != fCategories.end()) {
+    log4cpp::Category * cat = cat_iter->second;
+    if(strcmp(cat->getName().c_str(), stream) == 0) return *cat;
+  }
+
+  log4cpp::Category & MSG = log4cpp::Category::getInstance(stream);
+  fCategories[stream] = &MSG;
+
+  return MSG;
+}
+//____________________________________________________________________________
 void Messenger::Configure(void)
 {
 // The Configure() method will look for priority level xml config files, read
@@ -65,6 +65,45 @@ using std::string;
   #define ENDL std::endl
 #endif
 
+/*!
+  \def   __GENIE_MESG_PRIORITY_FLOOR__
+  \brief Least important priority level compiled into GENIE. Messages with
+         lower priority (eg pDEBUG or pINFO messages in a production build)
+         are removed at compile time. Set at configuration time with 
+         ./configure --with-mesg-floor=[FATAL,...,NOTICE,INFO,DEBUG]
+         (see Conventions/GBuild.h). Default: all messages are compiled in.
+*/
+
+#ifndef __GENIE_MESG_PRIORITY_FLOOR__
+  #define __GENIE_MESG_PRIORITY_FLOOR__ log4cpp::Priority::DEBUG
+#endif
+
+/*!
+  \def   MESG_ENABLED(stream, priority)
+  \brief Checks whether a message with the input priority would go through
+         the requested message stream (eg to skip code that only prepares
+         a lengthy printout).
+*/
+
+#define MESG_ENABLED(stream, priority) \
+           ( (priority) <= __GENIE_MESG_PRIORITY_FLOOR__ && \
+             Messenger::Instance()->IsPriorityEnabled(stream, priority) )
+
+/*!
+  \def   MESG_IF_ENABLED(stream, priority)
+  \brief Prefix used by all the message macros below. The stream name and
+         the priority are evaluated only once, by the MessengerGate, which
+         also returns the log4cpp::CategoryStream for an enabled message.
+         The message is the body of a for-statement executed at most once,
+         so it is skipped altogether when filtered, and the macros can still
+         be used safely in unbraced if/else blocks.
+*/
+
+#define MESG_IF_ENABLED(stream, priority) \
+           for(MessengerGate mesg_gate(stream, priority); \
+               mesg_gate.IsOpen(); mesg_gate.Close()) \
+             mesg_gate.Stream()
+
 /*!
   \def   SLOG(stream, priority)
   \brief A macro that returns the requested log4cpp::Category
@@ -73,8 +112,8 @@ using std::string;
 */
 
 #define SLOG(stream, priority) \
-           (*Messenger::Instance())(stream) \
-               << priority << "[s] <" \
+           MESG_IF_ENABLED(stream, priority) \
+               << "[s] <" \
                << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 /*!
@@ -85,49 +124,18 @@ using std::string;
 */
 
 #define LOG(stream, priority) \
-           (*Messenger::Instance())(stream) \
-               << priority << "[n] <" \
-               << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
-
-#define LOG_FATAL(stream) \
-          (*Messenger::Instance())(stream) \
-               << log4cpp::Priority::FATAL << "[n] <" \
-               << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
-
-#define LOG_ALERT(stream) \
-          (*Messenger::Instance())(stream) \
-               << log4cpp::Priority::ALERT << "[n] <" \
-               << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
-
-#define LOG_CRIT(stream) \
-          (*Messenger::Instance())(stream) \
-               << log4cpp::Priority::CRIT << "[n] <" \
-               << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
-
-#define LOG_ERROR(stream) \
-          (*Messenger::Instance())(stream) \
-               << log4cpp::Priority::ERROR << "[n] <" \
-               << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
-
-#define LOG_WARN(stream) \
-          (*Messenger::Instance())(stream) \
-               << log4cpp::Priority::WARN << "[n] <" \
-               << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
-
-#define LOG_NOTICE(stream) \
-          (*Messenger::Instance())(stream) \
-               << log4cpp::Priority::NOTICE << "[n] <" \
-               << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
-
-#define LOG_INFO(stream) \
-          (*Messenger::Instance())(stream) \
-               << log4cpp::Priority::INFO << "[n] <" \
+           MESG_IF_ENABLED(stream, priority) \
+               << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
-#define LOG_DEBUG(stream) \
-          (*Messenger::Instance())(stream) \
-               << log4cpp::Priority::DEBUG << "[n] <" \
-               << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
+#define LOG_FATAL(stream)  LOG(stream, log4cpp::Priority::FATAL)
+#define LOG_ALERT(stream)  LOG(stream, log4cpp::Priority::ALERT)
+#define LOG_CRIT(stream)   LOG(stream, log4cpp::Priority::CRIT)
+#define LOG_ERROR(stream)  LOG(stream, log4cpp::Priority::ERROR)
+#define LOG_WARN(stream)   LOG(stream, log4cpp::Priority::WARN)
+#define LOG_NOTICE(stream) LOG(stream, log4cpp::Priority::NOTICE)
+#define LOG_INFO(stream)   LOG(stream, log4cpp::Priority::INFO)
+#define LOG_DEBUG(stream)  LOG(stream, log4cpp::Priority::DEBUG)
 
 /*!
   \def   LLOG(stream, priority)
@@ -137,49 +145,18 @@ using std::string;
 */
 
 #define LLOG(stream, priority) \
-           (*Messenger::Instance())(stream) \
-               << priority << "[l] <" \
-               << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
-
-#define LLOG_FATAL(stream) \
-          (*Messenger::Instance())(stream) \
-               << log4cpp::Priority::FATAL << "[l] <" \
-               << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
-
-#define LLOG_ALERT(stream) \
-          (*Messenger::Instance())(stream) \
-               << log4cpp::Priority::ALERT << "[l] <" \
-               << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
-
-#define LLOG_CRIT(stream) \
-          (*Messenger::Instance())(stream) \
-               << log4cpp::Priority::CRIT << "[l] <" \
-               << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
-
-#define LLOG_ERROR(stream) \
-          (*Messenger::Instance())(stream) \
-               << log4cpp::Priority::ERROR << "[l] <" \
-               << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
-
-#define LLOG_WARN(stream) \
-          (*Messenger::Instance())(stream) \
-               << log4cpp::Priority::WARN << "'[l] <" \
-               << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
-
-#define LLOG_NOTICE(stream) \
-          (*Messenger::Instance())(stream) \
-               << log4cpp::Priority::NOTICE << "[l] <" \
-               << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
-
-#define LLOG_INFO(stream) \
-          (*Messenger::Instance())(stream) \
-               << log4cpp::Priority::INFO << "[l] <" \
+           MESG_IF_ENABLED(stream, priority) \
+               << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
-#define LLOG_DEBUG(stream) \
-          (*Messenger::Instance())(stream) \
-               << log4cpp::Priority::DEBUG << "[l] <" \
-               << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
+#define LLOG_FATAL(stream)  LLOG(stream, log4cpp::Priority::FATAL)
+#define LLOG_ALERT(stream)  LLOG(stream, log4cpp::Priority::ALERT)
+#define LLOG_CRIT(stream)   LLOG(stream, log4cpp::Priority::CRIT)
+#define LLOG_ERROR(stream)  LLOG(stream, log4cpp::Priority::ERROR)
+#define LLOG_WARN(stream)   LLOG(stream, log4cpp::Priority::WARN)
+#define LLOG_NOTICE(stream) LLOG(stream, log4cpp::Priority::NOTICE)
+#define LLOG_INFO(stream)   LLOG(stream, log4cpp::Priority::INFO)
+#define LLOG_DEBUG(stream)  LLOG(stream, log4cpp::Priority::DEBUG)
 
 /*!
   \def   BLOG(stream, priority)
@@ -188,7 +165,7 @@ using std::string;
 */
 
 #define BLOG(stream, priority) \
-	  (*Messenger::Instance())(stream) << priority
+           MESG_IF_ENABLED(stream, priority)
 
 namespace genie {
 
@@ -202,6 +179,10 @@ public:
   log4cpp::Category & operator () (const char * stream);
   void SetPriorityLevel(const char * stream, log4cpp::Priority::Value p);
 
+  bool IsPriorityEnabled(const char * stream, log4cpp::Priority::Value p);
+  log4cpp::Category * EnabledCategory(
+              const char * stream, log4cpp::Priority::Value p);
+
   bool SetPrioritiesFromXmlFile(string filename);
 
 private:
@@ -215,6 +196,13 @@ private:
 
   log4cpp::Priority::Value PriorityFromString(string priority);
 
+  log4cpp::Category & Category(const char * stream);
+
+  //! log4cpp categories looked-up so far, keyed by the address of the input
+  //! stream name (typically a string literal at the LOG call site) to avoid
+  //! building a std::string for every message
+  std::map<const char *, log4cpp::Category *> fCategories;
+
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
       ~Cleaner() {
@@ -227,5 +215,29 @@ private:
   friend struct Cleaner;
 };
 
+//! Evaluates the stream name and priority of a message macro once and
+//! holds the category of an enabled message (see MESG_IF_ENABLED).
+class MessengerGate
+{
+public:
+  MessengerGate(const char * stream, log4cpp::Priority::Value priority) :
+    fCategory(0), fPriority(priority)
+  {
+    if(priority <= __GENIE_MESG_PRIORITY_FLOOR__) {
+      fCategory = Messenger::Instance()->EnabledCategory(stream, priority);
+    }
+  }
+  bool IsOpen (void) const { return (fCategory != 0); }
+  void Close  (void)       { fCategory = 0;            }
+  log4cpp::CategoryStream Stream (void) const 
+  { 
+    return fCategory->getStream(fPriority); 
+  }
+
+private:
+  log4cpp::Category *      fCategory;
+  log4cpp::Priority::Value fPriority;
+};
+
 }      // genie namespace
 #endif // _MESSENGER_H_
@@ -13,6 +13,8 @@
 #pragma link C++ class genie::NtpMCRecHeader;
 #pragma link C++ class genie::NtpMCRecordI;
 #pragma link C++ class genie::NtpMCEventRecord;
+#pragma link C++ class genie::NtpMCFlatRecord;
+#pragma link C++ class genie::NtpMCEventSummary;
 #pragma link C++ class genie::NtpWriter;
 
 #endif
@@ -0,0 +1,183 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+         Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+         STFC, Rutherford Appleton Laboratory
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include <TTree.h>
+#include <TBranch.h>
+
+#include "EVGCore/EventRecord.h"
+#include "GHEP/GHepParticle.h"
+#include "GHEP/GHepStatus.h"
+#include "Interaction/Interaction.h"
+#include "Messenger/Messenger.h"
+#include "Ntuple/NtpMCEventSummary.h"
+#include "PDG/PDGCodes.h"
+#include "PDG/PDGUtils.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+NtpMCEventSummary::NtpMCEventSummary()
+{
+  this->Init();
+}
+//____________________________________________________________________________
+NtpMCEventSummary::~NtpMCEventSummary()
+{
+
+}
+//____________________________________________________________________________
+void NtpMCEventSummary::Init(void)
+{
+  neu     = 0;
+  cc      = false;
+  nc      = false;
+  nfp     = 0;
+  nfpbar  = 0;
+  nfn     = 0;
+  nfnbar  = 0;
+  nfpip   = 0;
+  nfpim   = 0;
+  nfpi0   = 0;
+  nfkp    = 0;
+  nfkm    = 0;
+  nfk0    = 0;
+  nfk0bar = 0;
+  nfsigp  = 0;
+  nfsig0  = 0;
+  nfsigm  = 0;
+  nflam   = 0;
+  nfxi0   = 0;
+  nfxim   = 0;
+  nfomm   = 0;
+  nfother = 0;
+}
+//____________________________________________________________________________
+void NtpMCEventSummary::Fill(const EventRecord * ev_rec)
+{
+  this->Init();
+
+  if(!ev_rec) return;
+
+  GHepParticle * probe = ev_rec->Probe();
+  if(probe) neu = probe->Pdg();
+
+  const Interaction * interaction = ev_rec->Summary();
+  if(interaction) {
+    cc = interaction->ProcInfo().IsWeakCC();
+    nc = interaction->ProcInfo().IsWeakNC();
+  }
+
+  TObjArrayIter piter(ev_rec);
+  GHepParticle * p = 0;
+  while( (p = (GHepParticle *) piter.Next())) {
+    int pdgc = p->Pdg();
+    int ist  = p->Status();
+    // only final state particles
+    if(ist!=kIStStableFinalState) continue;
+    // don't count final state lepton as part of the hadronic system
+    if(p->FirstMother()==0) continue;
+    // skip pseudo-particles
+    if(pdg::IsPseudoParticle(pdgc)) continue;
+    // count ...
+    if      (pdgc == kPdgProton     ) nfp++;
+    else if (pdgc == kPdgAntiProton ) nfpbar++;
+    else if (pdgc == kPdgNeutron    ) nfn++;
+    else if (pdgc == kPdgAntiNeutron) nfnbar++;
+    else if (pdgc == kPdgPiP        ) nfpip++;
+    else if (pdgc == kPdgPiM        ) nfpim++;
+    else if (pdgc == kPdgPi0        ) nfpi0++;
+    else if (pdgc == kPdgKP         ) nfkp++;
+    else if (pdgc == kPdgKM         ) nfkm++;
+    else if (pdgc == kPdgK0         ) nfk0++;
+    else if (pdgc == kPdgAntiK0     ) nfk0bar++;
+    else if (pdgc == kPdgSigmaP     ) nfsigp++;
+    else if (pdgc == kPdgSigma0     ) nfsig0++;
+    else if (pdgc == kPdgSigmaM     ) nfsigm++;
+    else if (pdgc == kPdgLambda     ) nflam++;
+    else if (pdgc == kPdgXi0        ) nfxi0++;
+    else if (pdgc == kPdgXiM        ) nfxim++;
+    else if (pdgc == kPdgOmegaM     ) nfomm++;
+    else                              nfother++;
+  }
+}
+//____________________________________________________________________________
+void NtpMCEventSummary::Branch(TTree * tree)
+{
+  tree->Branch("neu",     &neu,     "neu/I"     );
+  tree->Branch("cc",      &cc,      "cc/O"      );
+  tree->Branch("nc",      &nc,      "nc/O"      );
+  tree->Branch("nfp",     &nfp,     "nfp/I"     );
+  tree->Branch("nfpbar",  &nfpbar,  "nfpbar/I"  );
+  tree->Branch("nfn",     &nfn,     "nfn/I"     );
+  tree->Branch("nfnbar",  &nfnbar,  "nfnbar/I"  );
+  tree->Branch("nfpip",   &nfpip,   "nfpip/I"   );
+  tree->Branch("nfpim",   &nfpim,   "nfpim/I"   );
+  tree->Branch("nfpi0",   &nfpi0,   "nfpi0/I"   );
+  tree->Branch("nfkp",    &nfkp,    "nfkp/I"    );
+  tree->Branch("nfkm",    &nfkm,    "nfkm/I"    );
+  tree->Branch("nfk0",    &nfk0,    "nfk0/I"    );
+  tree->Branch("nfk0bar", &nfk0bar, "nfk0bar/I" );
+  tree->Branch("nfsigp",  &nfsigp,  "nfsigp/I"  );
+  tree->Branch("nfsig0",  &nfsig0,  "nfsig0/I"  );
+  tree->Branch("nfsigm",  &nfsigm,  "nfsigm/I"  );
+  tree->Branch("nflam",   &nflam,   "nflam/I"   );
+  tree->Branch("nfxi0",   &nfxi0,   "nfxi0/I"   );
+  tree->Branch("nfxim",   &nfxim,   "nfxim/I"   );
+  tree->Branch("nfomm",   &nfomm,   "nfomm/I"   );
+  tree->Branch("nfother", &nfother, "nfother/I" );
+}
+//____________________________________________________________________________
+bool NtpMCEventSummary::SetBranchAddresses(TTree * tree)
+{
+  fBranches.clear();
+
+  const int kNBranches = 22;
+  const char * names[kNBranches] = {
+    "neu", "cc", "nc", 
+    "nfp", "nfpbar", "nfn", "nfnbar", "nfpip", "nfpim", "nfpi0", 
+    "nfkp", "nfkm", "nfk0", "nfk0bar", "nfsigp", "nfsig0", "nfsigm", 
+    "nflam", "nfxi0", "nfxim", "nfomm", "nfother" 
+  };
+  void * addresses[kNBranches] = {
+    &neu, &cc, &nc,
+    &nfp, &nfpbar, &nfn, &nfnbar, &nfpip, &nfpim, &nfpi0,
+    &nfkp, &nfkm, &nfk0, &nfk0bar, &nfsigp, &nfsig0, &nfsigm,
+    &nflam, &nfxi0, &nfxim, &nfomm, &nfother
+  };
+
+  for(int i = 0; i < kNBranches; i++) {
+    TBranch * br = tree->GetBranch(names[i]);
+    if(!br) {
+      LOG("Ntp", pINFO) 
+        << "No summary branch " << names[i] << " in input tree";
+      fBranches.clear();
+      return false;
+    }
+    tree->SetBranchAddress(names[i], addresses[i]);
+    fBranches.push_back(br);
+  }
+  return true;
+}
+//____________________________________________________________________________
+void NtpMCEventSummary::GetEntry(Long64_t iev)
+{
+  vector<TBranch *>::iterator it = fBranches.begin();
+  for( ; it != fBranches.end(); ++it) {
+    (*it)->GetEntry(iev);
+  }
+}
+//____________________________________________________________________________
@@ -0,0 +1,96 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpMCEventSummary
+
+\brief   Summary columns stored by NtpWriter alongside the full GHEP event
+         record (kNFGHEP format): the probe, the CC/NC flags and the number of
+         final state hadrons by species.
+
+         Each data member is stored in its own TTree branch, so clients (eg
+         gevpick) can read the summary of an event and reject it before
+         deserializing its GHEP record.
+         Particles are counted as in gevpick: stable final state particles
+         only, excluding pseudo-particles and the daughters of the probe
+         (ie the final state primary lepton).
+
+         To read the summary columns:
+           NtpMCEventSummary sum;
+           if(sum.SetBranchAddresses(tree)) sum.GetEntry(i);
+
+\author  The GENIE Collaboration
+         Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+         STFC, Rutherford Appleton Laboratory
+
+\created October 16, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_MC_EVENT_SUMMARY_H_
+#define _NTP_MC_EVENT_SUMMARY_H_
+
+#include <vector>
+
+#include <Rtypes.h>
+
+class TTree;
+class TBranch;
+
+using std::vector;
+
+namespace genie {
+
+class EventRecord;
+
+class NtpMCEventSummary {
+
+public :
+  NtpMCEventSummary();
+ ~NtpMCEventSummary();
+
+  void Init (void);
+  void Fill (const EventRecord * ev_rec);
+
+  void Branch             (TTree * tree); ///< create the branches of an output tree
+  bool SetBranchAddresses (TTree * tree); ///< read the branches of an input tree (false if missing)
+  void GetEntry           (Long64_t iev); ///< read only the summary branches
+
+  // Ntuple is treated like a C-struct with public data members and
+  // rule-breaking field data members not prefaced by "f" and mostly lowercase.
+  // The names match those of the gntpc `gst' summary tree where applicable.
+
+  int    neu;          ///< probe pdg code
+  bool   cc;           ///< is weak CC process?
+  bool   nc;           ///< is weak NC process?
+  int    nfp;          ///< number of final state p
+  int    nfpbar;       ///< number of final state \bar{p}
+  int    nfn;          ///< number of final state n
+  int    nfnbar;       ///< number of final state \bar{n}
+  int    nfpip;        ///< number of final state \pi^{+}
+  int    nfpim;        ///< number of final state \pi^{-}
+  int    nfpi0;        ///< number of final state \pi^{0}
+  int    nfkp;         ///< number of final state K^{+}
+  int    nfkm;         ///< number of final state K^{-}
+  int    nfk0;         ///< number of final state K^{0}
+  int    nfk0bar;      ///< number of final state \bar{K^{0}}
+  int    nfsigp;       ///< number of final state \Sigma^{+}
+  int    nfsig0;       ///< number of final state \Sigma^{0}
+  int    nfsigm;       ///< number of final state \Sigma^{-}
+  int    nflam;        ///< number of final state \Lambda^{0}
+  int    nfxi0;        ///< number of final state \Xi^{0}
+  int    nfxim;        ///< number of final state \Xi^{-}
+  int    nfomm;        ///< number of final state \Omega^{-}
+  int    nfother;      ///< number of other final state particles
+
+private:
+
+  vector<TBranch *> fBranches; //! input branches
+};
+
+}      // genie namespace
+
+#endif // _NTP_MC_EVENT_SUMMARY_H_
@@ -0,0 +1,331 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+         Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+         STFC, Rutherford Appleton Laboratory
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include <TLorentzVector.h>
+#include <TMath.h>
+#include <TTree.h>
+
+#include "Conventions/Constants.h"
+#include "EVGCore/EventRecord.h"
+#include "GHEP/GHepParticle.h"
+#include "Interaction/Interaction.h"
+#include "Messenger/Messenger.h"
+#include "Ntuple/NtpMCFlatRecord.h"
+
+using namespace genie;
+using namespace genie::constants;
+
+const int NtpMCFlatRecord::kNPmax;
+
+//____________________________________________________________________________
+NtpMCFlatRecord::NtpMCFlatRecord()
+{
+  this->Init();
+}
+//____________________________________________________________________________
+NtpMCFlatRecord::~NtpMCFlatRecord()
+{
+
+}
+//____________________________________________________________________________
+void NtpMCFlatRecord::Init(void)
+{
+  iev    = 0;
+  neu    = 0;
+  fspl   = 0;
+  tgt    = 0;
+  Z      = 0;
+  A      = 0;
+  hitnuc = 0;
+  hitqrk = 0;
+  resid  = -99;
+  scat   = -1;
+  intt   = -1;
+  qel    = false;
+  res    = false;
+  dis    = false;
+  coh    = false;
+  dfr    = false;
+  mec    = false;
+  imd    = false;
+  nuel   = false;
+  em     = false;
+  cc     = false;
+  nc     = false;
+  charm  = false;
+  unphys = false;
+  wght   = 0.;
+  prob   = 0.;
+  xsec   = 0.;
+  dxsec  = 0.;
+  Ev     = 0.;
+  pxv    = 0.;
+  pyv    = 0.;
+  pzv    = 0.;
+  xs     = -1.;
+  ys     = -1.;
+  ts     = -1.;
+  Q2s    = -1.;
+  Ws     = -1.;
+  x      = -1.;
+  y      = -1.;
+  t      =  0.;
+  Q2     = -1.;
+  W      = -1.;
+  vtxx   = 0.;
+  vtxy   = 0.;
+  vtxz   = 0.;
+  vtxt   = 0.;
+  n      = 0;
+}
+//____________________________________________________________________________
+void NtpMCFlatRecord::Fill(unsigned int ievent, const EventRecord * ev_rec)
+{
+  this->Init();
+
+  iev    = (int) ievent;
+  unphys = ev_rec->IsUnphysical();
+  wght   = ev_rec->Weight();
+  prob   = ev_rec->Probability();
+  xsec   = ev_rec->XSec();
+  dxsec  = ev_rec->DiffXSec();
+
+  const TLorentzVector * vtx = ev_rec->Vertex();
+  if(vtx) {
+    vtxx = vtx->X();
+    vtxy = vtx->Y();
+    vtxz = vtx->Z();
+    vtxt = vtx->T();
+  }
+
+  GHepParticle * probe = ev_rec->Probe();
+  if(probe) {
+    Ev  = probe->E();
+    pxv = probe->Px();
+    pyv = probe->Py();
+    pzv = probe->Pz();
+  }
+
+  // interaction summary
+  const Interaction * interaction = ev_rec->Summary();
+  if(interaction) {
+    const InitialState & init_state = interaction->InitState();
+    const ProcessInfo &  proc_info  = interaction->ProcInfo();
+    const Kinematics &   kine       = interaction->Kine();
+    const XclsTag &      xcls       = interaction->ExclTag();
+    const Target &       target     = init_state.Tgt();
+
+    neu    = init_state.ProbePdg();
+    fspl   = interaction->FSPrimLeptonPdg();
+    tgt    = target.Pdg();
+    Z      = target.Z();
+    A      = target.A();
+    hitnuc = (target.HitNucIsSet()) ? target.HitNucPdg() : 0;
+    hitqrk = (target.HitQrkIsSet()) ? target.HitQrkPdg() : 0;
+    resid  = (xcls.KnownResonance()) ? (int) xcls.Resonance() : -99;
+    charm  = xcls.IsCharmEvent();
+
+    scat   = (int) proc_info.ScatteringTypeId();
+    intt   = (int) proc_info.InteractionTypeId();
+    qel    = proc_info.IsQuasiElastic();
+    res    = proc_info.IsResonant();
+    dis    = proc_info.IsDeepInelastic();
+    coh    = proc_info.IsCoherent();
+    dfr    = proc_info.IsDiffractive();
+    mec    = proc_info.IsMEC();
+    imd    = proc_info.IsInverseMuDecay();
+    nuel   = proc_info.IsNuElectronElastic();
+    em     = proc_info.IsEM();
+    cc     = proc_info.IsWeakCC();
+    nc     = proc_info.IsWeakNC();
+
+    // kinematics exactly as they were selected
+    if(kine.KVSet(kKVSelx )) xs  = kine.GetKV(kKVSelx );
+    if(kine.KVSet(kKVSely )) ys  = kine.GetKV(kKVSely );
+    if(kine.KVSet(kKVSelt )) ts  = kine.GetKV(kKVSelt );
+    if(kine.KVSet(kKVSelQ2)) Q2s = kine.GetKV(kKVSelQ2);
+    if(kine.KVSet(kKVSelW )) Ws  = kine.GetKV(kKVSelW );
+  }
+
+  // kinematics as an experimentalist would measure them, neglecting the 
+  // fermi momentum and off-shellness of bound nucleons (as in gntpc)
+  GHepParticle * fsl     = ev_rec->FinalStatePrimaryLepton();
+  GHepParticle * hitnucl = ev_rec->HitNucleon();
+  if(probe && fsl) {
+    const TLorentzVector & k1 = *(probe->P4()); // v 4-p (k1)
+    const TLorentzVector & k2 = *(fsl->P4());   // l 4-p (k2)
+
+    double M = kNucleonMass;
+    TLorentzVector q = k1-k2;                   // q=k1-k2, 4-p transfer
+    Q2 = -1 * q.M2();
+    if(hitnucl) {
+      double v  = q.Energy();                   // E transfer to the nucleus
+      double W2 = M*M + 2*M*v - Q2;
+      x = 0.5*Q2/(M*v);
+      y = v/k1.Energy();
+      W = TMath::Sqrt(W2);
+    }
+  }
+
+  // GHEP entries
+  n = ev_rec->GetEntries();
+  if(n > kNPmax) {
+    LOG("Ntp", pWARN)
+      << "Event " << ievent << " has " << n << " GHEP entries. "
+      << "Storing only the first " << kNPmax;
+    n = kNPmax;
+  }
+  for(int i = 0; i < n; i++) {
+    GHepParticle * p = ev_rec->Particle(i);
+    pdg  [i] = p->Pdg();
+    ist  [i] = (int) p->Status();
+    resc [i] = p->RescatterCode();
+    fm   [i] = p->FirstMother();
+    lm   [i] = p->LastMother();
+    fd   [i] = p->FirstDaughter();
+    ld   [i] = p->LastDaughter();
+    E    [i] = p->E();
+    px   [i] = p->Px();
+    py   [i] = p->Py();
+    pz   [i] = p->Pz();
+  }
+}
+//____________________________________________________________________________
+void NtpMCFlatRecord::Branch(TTree * tree)
+{
+  tree->Branch("iev",    &iev,    "iev/I"    );
+  tree->Branch("neu",    &neu,    "neu/I"    );
+  tree->Branch("fspl",   &fspl,   "fspl/I"   );
+  tree->Branch("tgt",    &tgt,    "tgt/I"    );
+  tree->Branch("Z",      &Z,      "Z/I"      );
+  tree->Branch("A",      &A,      "A/I"      );
+  tree->Branch("hitnuc", &hitnuc, "hitnuc/I" );
+  tree->Branch("hitqrk", &hitqrk, "hitqrk/I" );
+  tree->Branch("resid",  &resid,  "resid/I"  );
+  tree->Branch("scat",   &scat,   "scat/I"   );
+  tree->Branch("intt",   &intt,   "intt/I"   );
+  tree->Branch("qel",    &qel,    "qel/O"    );
+  tree->Branch("res",    &res,    "res/O"    );
+  tree->Branch("dis",    &dis,    "dis/O"    );
+  tree->Branch("coh",    &coh,    "coh/O"    );
+  tree->Branch("dfr",    &dfr,    "dfr/O"    );
+  tree->Branch("mec",    &mec,    "mec/O"    );
+  tree->Branch("imd",    &imd,    "imd/O"    );
+  tree->Branch("nuel",   &nuel,   "nuel/O"   );
+  tree->Branch("em",     &em,     "em/O"     );
+  tree->Branch("cc",     &cc,     "cc/O"     );
+  tree->Branch("nc",     &nc,     "nc/O"     );
+  tree->Branch("charm",  &charm,  "charm/O"  );
+  tree->Branch("unphys", &unphys, "unphys/O" );
+  tree->Branch("wght",   &wght,   "wght/D"   );
+  tree->Branch("prob",   &prob,   "prob/D"   );
+  tree->Branch("xsec",   &xsec,   "xsec/D"   );
+  tree->Branch("dxsec",  &dxsec,  "dxsec/D"  );
+  tree->Branch("Ev",     &Ev,     "Ev/D"     );
+  tree->Branch("pxv",    &pxv,    "pxv/D"    );
+  tree->Branch("pyv",    &pyv,    "pyv/D"    );
+  tree->Branch("pzv",    &pzv,    "pzv/D"    );
+  tree->Branch("xs",     &xs,     "xs/D"     );
+  tree->Branch("ys",     &ys,     "ys/D"     );
+  tree->Branch("ts",     &ts,     "ts/D"     );
+  tree->Branch("Q2s",    &Q2s,    "Q2s/D"    );
+  tree->Branch("Ws",     &Ws,     "Ws/D"     );
+  tree->Branch("x",      &x,      "x/D"      );
+  tree->Branch("y",      &y,      "y/D"      );
+  tree->Branch("t",      &t,      "t/D"      );
+  tree->Branch("Q2",     &Q2,     "Q2/D"     );
+  tree->Branch("W",      &W,      "W/D"      );
+  tree->Branch("vtxx",   &vtxx,   "vtxx/D"   );
+  tree->Branch("vtxy",   &vtxy,   "vtxy/D"   );
+  tree->Branch("vtxz",   &vtxz,   "vtxz/D"   );
+  tree->Branch("vtxt",   &vtxt,   "vtxt/D"   );
+  tree->Branch("n",      &n,      "n/I"      );
+  tree->Branch("pdg",    pdg,     "pdg[n]/I" );
+  tree->Branch("ist",    ist,     "ist[n]/I" );
+  tree->Branch("resc",   resc,    "resc[n]/I");
+  tree->Branch("fm",     fm,      "fm[n]/I"  );
+  tree->Branch("lm",     lm,      "lm[n]/I"  );
+  tree->Branch("fd",     fd,      "fd[n]/I"  );
+  tree->Branch("ld",     ld,      "ld[n]/I"  );
+  tree->Branch("E",      E,       "E[n]/D"   );
+  tree->Branch("px",     px,      "px[n]/D"  );
+  tree->Branch("py",     py,      "py[n]/D"  );
+  tree->Branch("pz",     pz,      "pz[n]/D"  );
+}
+//____________________________________________________________________________
+void NtpMCFlatRecord::SetBranchAddresses(TTree * tree)
+{
+  tree->SetBranchAddress("iev",    &iev    );
+  tree->SetBranchAddress("neu",    &neu    );
+  tree->SetBranchAddress("fspl",   &fspl   );
+  tree->SetBranchAddress("tgt",    &tgt    );
+  tree->SetBranchAddress("Z",      &Z      );
+  tree->SetBranchAddress("A",      &A      );
+  tree->SetBranchAddress("hitnuc", &hitnuc );
+  tree->SetBranchAddress("hitqrk", &hitqrk );
+  tree->SetBranchAddress("resid",  &resid  );
+  tree->SetBranchAddress("scat",   &scat   );
+  tree->SetBranchAddress("intt",   &intt   );
+  tree->SetBranchAddress("qel",    &qel    );
+  tree->SetBranchAddress("res",    &res    );
+  tree->SetBranchAddress("dis",    &dis    );
+  tree->SetBranchAddress("coh",    &coh    );
+  tree->SetBranchAddress("dfr",    &dfr    );
+  tree->SetBranchAddress("mec",    &mec    );
+  tree->SetBranchAddress("imd",    &imd    );
+  tree->SetBranchAddress("nuel",   &nuel   );
+  tree->SetBranchAddress("em",     &em     );
+  tree->SetBranchAddress("cc",     &cc     );
+  tree->SetBranchAddress("nc",     &nc     );
+  tree->SetBranchAddress("charm",  &charm  );
+  tree->SetBranchAddress("unphys", &unphys );
+  tree->SetBranchAddress("wght",   &wght   );
+  tree->SetBranchAddress("prob",   &prob   );
+  tree->SetBranchAddress("xsec",   &xsec   );
+  tree->SetBranchAddress("dxsec",  &dxsec  );
+  tree->SetBranchAddress("Ev",     &Ev     );
+  tree->SetBranchAddress("pxv",    &pxv    );
+  tree->SetBranchAddress("pyv",    &pyv    );
+  tree->SetBranchAddress("pzv",    &pzv    );
+  tree->SetBranchAddress("xs",     &xs     );
+  tree->SetBranchAddress("ys",     &ys     );
+  tree->SetBranchAddress("ts",     &ts     );
+  tree->SetBranchAddress("Q2s",    &Q2s    );
+  tree->SetBranchAddress("Ws",     &Ws     );
+  tree->SetBranchAddress("x",      &x      );
+  tree->SetBranchAddress("y",      &y      );
+  tree->SetBranchAddress("t",      &t      );
+  tree->SetBranchAddress("Q2",     &Q2     );
+  tree->SetBranchAddress("W",      &W      );
+  tree->SetBranchAddress("vtxx",   &vtxx   );
+  tree->SetBranchAddress("vtxy",   &vtxy   );
+  tree->SetBranchAddress("vtxz",   &vtxz   );
+  tree->SetBranchAddress("vtxt",   &vtxt   );
+  tree->SetBranchAddress("n",      &n      );
+  tree->SetBranchAddress("pdg",    pdg     );
+  tree->SetBranchAddress("ist",    ist     );
+  tree->SetBranchAddress("resc",   resc    );
+  tree->SetBranchAddress("fm",     fm      );
+  tree->SetBranchAddress("lm",     lm      );
+  tree->SetBranchAddress("fd",     fd      );
+  tree->SetBranchAddress("ld",     ld      );
+  tree->SetBranchAddress("E",      E       );
+  tree->SetBranchAddress("px",     px      );
+  tree->SetBranchAddress("py",     py      );
+  tree->SetBranchAddress("pz",     pz      );
+}
+//____________________________________________________________________________
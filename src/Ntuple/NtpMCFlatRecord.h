@@ -0,0 +1,127 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpMCFlatRecord
+
+\brief   Flat (columnar) summary of a GENIE event, written directly at event
+         generation time by NtpWriter in the kNFFlat format.
+
+         Each data member is stored in its own TTree branch: Per-event
+         scalars (event number, initial state, process flags, weights, the
+         kinematics as selected during event generation and as computed
+         from the 4-momenta like in the gntpc `gst' tree, the vertex) and
+         per-particle arrays of variable length (pdg code, status, mothers,
+         daughters, 4-momentum) for all n entries of the GHEP record.
+         Analyses can then read only the branches they need, without
+         deserializing the full GHEP record (and without first converting
+         the GHEP file with gntpc).
+
+         To read a flat tree:
+           NtpMCFlatRecord rec;
+           rec.SetBranchAddresses(tree);
+           tree->GetEntry(i);
+
+\author  The GENIE Collaboration
+         Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+         STFC, Rutherford Appleton Laboratory
+
+\created October 16, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_MC_FLAT_RECORD_H_
+#define _NTP_MC_FLAT_RECORD_H_
+
+#include <Rtypes.h>
+
+class TTree;
+
+namespace genie {
+
+class EventRecord;
+
+class NtpMCFlatRecord {
+
+public :
+  NtpMCFlatRecord();
+ ~NtpMCFlatRecord();
+
+  void Init (void);
+  void Fill (unsigned int ievent, const EventRecord * ev_rec);
+
+  void Branch             (TTree * tree); ///< create the branches of an output tree
+  void SetBranchAddresses (TTree * tree); ///< read the branches of an input tree
+
+  static const int kNPmax = 250; ///< max number of GHEP entries stored
+
+  // Ntuple is treated like a C-struct with public data members and
+  // rule-breaking field data members not prefaced by "f" and mostly lowercase.
+  // The names match those of the gntpc `gst' summary tree where applicable.
+
+  int    iev;          ///< event number
+  int    neu;          ///< probe pdg code
+  int    fspl;         ///< final state primary lepton pdg code
+  int    tgt;          ///< target pdg code
+  int    Z;            ///< target Z
+  int    A;            ///< target A
+  int    hitnuc;       ///< hit nucleon pdg code (0 if not set)
+  int    hitqrk;       ///< hit quark pdg code (0 if not set)
+  int    resid;        ///< baryon resonance id (-99 if not set)
+  int    scat;         ///< scattering type (see ScatteringType_t)
+  int    intt;         ///< interaction type (see InteractionType_t)
+  bool   qel;          ///< is QEL?
+  bool   res;          ///< is RES?
+  bool   dis;          ///< is DIS?
+  bool   coh;          ///< is coherent?
+  bool   dfr;          ///< is diffractive?
+  bool   mec;          ///< is MEC?
+  bool   imd;          ///< is IMD?
+  bool   nuel;         ///< is ve elastic?
+  bool   em;           ///< is EM process?
+  bool   cc;           ///< is weak CC process?
+  bool   nc;           ///< is weak NC process?
+  bool   charm;        ///< produces charm?
+  bool   unphys;       ///< is unphysical?
+  double wght;         ///< event weight
+  double prob;         ///< event probability
+  double xsec;         ///< cross section for the selected interaction (natural units)
+  double dxsec;        ///< differential cross section for the selected kinematics (natural units)
+  double Ev;           ///< probe energy @ LAB
+  double pxv;          ///< probe px @ LAB
+  double pyv;          ///< probe py @ LAB
+  double pzv;          ///< probe pz @ LAB
+  double xs;           ///< Bjorken x as selected (-1 if not set)
+  double ys;           ///< inelasticity y as selected (-1 if not set)
+  double ts;           ///< t as selected (-1 if not set)
+  double Q2s;          ///< Q^2 as selected (-1 if not set)
+  double Ws;           ///< W as selected (-1 if not set)
+  double x;            ///< experimental-like Bjorken x, from the 4-momenta (-1 if no hit nucleon)
+  double y;            ///< experimental-like inelasticity y, from the 4-momenta (-1 if no hit nucleon)
+  double t;            ///< experimental-like t (0, as in gntpc)
+  double Q2;           ///< experimental-like Q^2, from the 4-momenta
+  double W;            ///< experimental-like W, from the 4-momenta (-1 if no hit nucleon)
+  double vtxx;         ///< vertex x in detector coord system (SI)
+  double vtxy;         ///< vertex y in detector coord system (SI)
+  double vtxz;         ///< vertex z in detector coord system (SI)
+  double vtxt;         ///< vertex t in detector coord system (SI)
+  int    n;            ///< number of GHEP entries stored
+  int    pdg  [kNPmax]; ///< pdg code of the k^th GHEP entry
+  int    ist  [kNPmax]; ///< status code of the k^th GHEP entry
+  int    resc [kNPmax]; ///< rescattering code of the k^th GHEP entry
+  int    fm   [kNPmax]; ///< first mother of the k^th GHEP entry
+  int    lm   [kNPmax]; ///< last mother of the k^th GHEP entry
+  int    fd   [kNPmax]; ///< first daughter of the k^th GHEP entry
+  int    ld   [kNPmax]; ///< last daughter of the k^th GHEP entry
+  double E    [kNPmax]; ///< energy of the k^th GHEP entry @ LAB
+  double px   [kNPmax]; ///< px of the k^th GHEP entry @ LAB
+  double py   [kNPmax]; ///< py of the k^th GHEP entry @ LAB
+  double pz   [kNPmax]; ///< pz of the k^th GHEP entry @ LAB
+};
+
+}      // genie namespace
+
+#endif // _NTP_MC_FLAT_RECORD_H_
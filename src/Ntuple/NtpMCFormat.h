@@ -28,7 +28,8 @@ namespace genie {
 typedef enum ENtpMCFormat {
 
    kNFUndefined = -1,
-   kNFGHEP   /* each mc tree leaf contains the full GHEP EventRecord */
+   kNFGHEP,  /* each mc tree leaf contains the full GHEP EventRecord */
+   kNFFlat   /* flat columnar summary branches (see NtpMCFlatRecord) */
 
 } NtpMCFormat_t;
 
@@ -42,6 +43,9 @@ class NtpMCFormat {
      case kNFGHEP:
               return "[NtpMCEventRecord]";
               break;
+     case kNFFlat:
+              return "[NtpMCFlatRecord]";
+              break;
      default:
               break;
      }
@@ -60,6 +64,9 @@ class NtpMCFormat {
      case kNFGHEP:
               return "ghep";
               break;
+     case kNFFlat:
+              return "flat";
+              break;
      default:
               break;
      }
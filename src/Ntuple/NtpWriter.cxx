@@ -23,17 +23,32 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
 #include <sstream>
 
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
 #include <TFile.h>
 #include <TTree.h>
 #include <TClonesArray.h>
 #include <TFolder.h>
+#include <TBufferFile.h>
 
 #include "EVGCore/EventRecord.h"
 #include "Messenger/Messenger.h"
 #include "Ntuple/NtpWriter.h"
 #include "Ntuple/NtpMCEventRecord.h"
+#include "Ntuple/NtpMCEventSummary.h"
+#include "Ntuple/NtpMCFlatRecord.h"
 #include "Ntuple/NtpMCTreeHeader.h"
 #include "Ntuple/NtpMCJobConfig.h"
 #include "Ntuple/NtpMCJobEnv.h"
@@ -50,7 +65,18 @@ fOutFile(0),
 fOutTree(0),
 fEventBranch(0),
 fNtpMCEventRecord(0),
-fNtpMCTreeHeader(0)
+fNtpMCFlatRecord(0),
+fNtpMCEventSummary(0),
+fNtpMCTreeHeader(0),
+fCompressAlg(-1),
+fCompressLevel(-1),
+fBasketSize(32000),
+fAsync(false),
+fAsyncBufSize(0),
+fAsyncPid(-1),
+fAsyncFd(-1),
+fAsyncBufPos(0),
+fAsyncFailed(false)
 {
   LOG("Ntp", pNOTICE) << "Run number: " << runnu;
   LOG("Ntp", pNOTICE)
@@ -61,7 +87,9 @@ fNtpMCTreeHeader(0)
 //____________________________________________________________________________
 NtpWriter::~NtpWriter()
 {
-
+  if(fAsyncPid > 0) this->StopAsyncWriter();
+  if(fNtpMCFlatRecord) delete fNtpMCFlatRecord;
+  if(fNtpMCEventSummary) delete fNtpMCEventSummary;
 }
 //____________________________________________________________________________
 void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
@@ -72,6 +100,24 @@ void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
     LOG("Ntp", pERROR) << "NULL input EventRecord!";
     return;
   }
+  if(fAsyncPid > 0) {
+    if(fAsyncFailed) {
+      LOG("Ntp", pERROR) 
+        << "The writer process is gone - Event " << ievent << " is lost";
+      return;
+    }
+    // serialize the event & hand it over to the writer process
+    NtpMCEventRecord mcrec;
+    mcrec.Fill(ievent, ev_rec);
+    TBufferFile buf(TBuffer::kWrite);
+    buf.WriteObjectAny(&mcrec, NtpMCEventRecord::Class());
+    UInt_t len = buf.Length();
+    fAsyncBuf.insert(fAsyncBuf.end(), 
+        (char *) &len, (char *) &len + sizeof(UInt_t));
+    fAsyncBuf.insert(fAsyncBuf.end(), buf.Buffer(), buf.Buffer() + len);
+    this->WriteAsyncBuffer(false);
+    return;
+  }
   if(!fOutTree) {
     LOG("Ntp", pERROR) << "No open output TTree to add the input EventRecord!";
     return;
@@ -81,16 +127,109 @@ void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
      case kNFGHEP:
           fNtpMCEventRecord = new NtpMCEventRecord();
           fNtpMCEventRecord->Fill(ievent, ev_rec);
+          fNtpMCEventSummary->Fill(ev_rec);
           fOutTree->Fill();
           delete fNtpMCEventRecord;
           fNtpMCEventRecord = 0;
           break;
+     case kNFFlat:
+          fNtpMCFlatRecord->Fill(ievent, ev_rec);
+          fOutTree->Fill();
+          break;
      default:
         break;
   }
 }
 //____________________________________________________________________________
+bool NtpWriter::AddEventRecords(string filename)
+{
+  LOG("Ntp", pNOTICE) << "Adding events from: " << filename;
+
+  if(!fOutTree) {
+    LOG("Ntp", pERROR) << "No open output TTree to add the input events!";
+    return false;
+  }
+  if(fAsyncPid > 0) {
+    LOG("Ntp", pERROR) << "Can not add events in asynchronous mode";
+    return false;
+  }
+  if(fNtpFormat != kNFGHEP && fNtpFormat != kNFFlat) {
+    LOG("Ntp", pERROR) 
+      << "Can not add events to a " << NtpMCFormat::AsString(fNtpFormat)
+      << " tree";
+    return false;
+  }
+
+  TFile inp_file(filename.c_str(), "READ");
+  TTree * inp_tree = 
+       (inp_file.IsZombie()) ? 0 : dynamic_cast<TTree*>(inp_file.Get("gtree"));
+  if(!inp_tree) {
+    LOG("Ntp", pERROR) << "No GHEP event tree found in: " << filename;
+    if(fOutFile) fOutFile->cd();
+    return false;
+  }
+
+  // flat input: copy the branches as they are
+  if(fNtpFormat == kNFFlat && inp_tree->GetBranch("gmcrec") == 0) {
+    NtpMCFlatRecord flatrec;
+    flatrec.SetBranchAddresses(inp_tree);
+    Long64_t nev = inp_tree->GetEntries();
+    for(Long64_t iev = 0; iev < nev; iev++) {
+      inp_tree->GetEntry(iev);
+      *fNtpMCFlatRecord = flatrec;
+      fOutTree->Fill();
+    }
+    inp_file.Close();
+    if(fOutFile) fOutFile->cd();
+    LOG("Ntp", pNOTICE) << "Added " << nev << " events from: " << filename;
+    return true;
+  }
+
+  NtpMCEventRecord * mcrec = 0;
+  inp_tree->SetBranchAddress("gmcrec", &mcrec);
+
+  Long64_t nev = inp_tree->GetEntries();
+  for(Long64_t iev = 0; iev < nev; iev++) {
+    inp_tree->GetEntry(iev);
+    this->AddEventRecord(mcrec->hdr.ievent, mcrec->event);
+    mcrec->Clear();
+  }
+  inp_file.Close();
+
+  if(fOutFile) fOutFile->cd();
+
+  LOG("Ntp", pNOTICE) << "Added " << nev << " events from: " << filename;
+  return true;
+}
+//____________________________________________________________________________
 void NtpWriter::Initialize()
+{
+  if(fAsync) {
+    bool started = this->StartAsyncWriter();
+    if(started) return;
+    LOG("Ntp", pWARN) << "Falling back to synchronous output";
+  }
+  this->InitOutput();
+}
+//____________________________________________________________________________
+void NtpWriter::EnableAsyncOutput(bool enable, unsigned int buf_size)
+{
+  fAsync        = enable;
+  fAsyncBufSize = buf_size;
+}
+//____________________________________________________________________________
+void NtpWriter::SetCompression(int algorithm, int level)
+{
+  fCompressAlg   = algorithm;
+  fCompressLevel = level;
+}
+//____________________________________________________________________________
+void NtpWriter::SetBasketSize(int basket_size)
+{
+  fBasketSize = basket_size;
+}
+//____________________________________________________________________________
+void NtpWriter::InitOutput(void)
 {
   LOG("Ntp",pINFO) << "Initializing GENIE output MC tree";
 
@@ -142,6 +281,9 @@ void NtpWriter::OpenFile(string filename)
       << "Opening the output ROOT file: " << filename;
 
   fOutFile = new TFile(filename.c_str(),"RECREATE");
+
+  if(fCompressAlg   >= 0) fOutFile->SetCompressionAlgorithm (fCompressAlg);
+  if(fCompressLevel >= 0) fOutFile->SetCompressionLevel     (fCompressLevel);
 }
 //____________________________________________________________________________
 void NtpWriter::CreateTree(void)
@@ -163,14 +305,17 @@ void NtpWriter::CreateEventBranch(void)
   switch (fNtpFormat) {
      case kNFGHEP:
         this->CreateGHEPEventBranch();
+        assert(fEventBranch);
+        fEventBranch->SetAutoDelete(kFALSE);
+        break;
+     case kNFFlat:
+        this->CreateFlatEventBranches();
         break;
      default:
         LOG("Ntp", pERROR)
            << "Unknown TTree format. Can not create TBranches";
         break;
   }
-  assert(fEventBranch);
-  fEventBranch->SetAutoDelete(kFALSE);
 }
 //____________________________________________________________________________
 void NtpWriter::CreateGHEPEventBranch(void)
@@ -181,7 +326,23 @@ void NtpWriter::CreateGHEPEventBranch(void)
   TTree::SetBranchStyle(1);
 
   fEventBranch = fOutTree->Branch("gmcrec",
-      "genie::NtpMCEventRecord", &fNtpMCEventRecord, 32000, 1);
+      "genie::NtpMCEventRecord", &fNtpMCEventRecord, fBasketSize, 1);
+
+  // summary columns, used for selecting events without reading GHEP
+  if(fNtpMCEventSummary) delete fNtpMCEventSummary;
+  fNtpMCEventSummary = new NtpMCEventSummary;
+  fNtpMCEventSummary->Branch(fOutTree);
+}
+//____________________________________________________________________________
+void NtpWriter::CreateFlatEventBranches(void)
+{
+  LOG("Ntp", pINFO) << "Creating the NtpMCFlatRecord TBranches";
+
+  if(fNtpMCFlatRecord) delete fNtpMCFlatRecord;
+  fNtpMCFlatRecord = new NtpMCFlatRecord;
+  fNtpMCFlatRecord->Branch(fOutTree);
+
+  if(fBasketSize > 0) fOutTree->SetBasketSize("*", fBasketSize);
 }
 //____________________________________________________________________________
 void NtpWriter::CreateTreeHeader(void)
@@ -198,7 +359,15 @@ void NtpWriter::CreateTreeHeader(void)
   LOG("Ntp", pINFO) << *fNtpMCTreeHeader;
 }
 //____________________________________________________________________________
-void NtpWriter::Save(void)
+bool NtpWriter::Save(void)
+{
+  if(fAsyncPid > 0) {
+    return this->StopAsyncWriter();
+  }
+  return this->SaveOutput();
+}
+//____________________________________________________________________________
+bool NtpWriter::SaveOutput(void)
 {
   LOG("Ntp", pINFO) << "Saving the output tree";
 
@@ -211,7 +380,205 @@ void NtpWriter::Save(void)
 
   } else {
      LOG("Ntp", pERROR) << "No open ROOT file was found";
+     return false;
+  }
+  return true;
+}
+//____________________________________________________________________________
+
+bool NtpWriter::StartAsyncWriter(void)
+{
+// Fork the writer process. The writer opens the output file, creates the
+// event tree and then fills it with the events read from the pipe until the
+// pipe is closed by Save().
+
+  int fd[2];
+  if(pipe(fd) != 0) {
+    LOG("Ntp", pERROR) 
+      << "Could not create a pipe to the writer process: " << strerror(errno);
+    return false;
+  }
+
+  // flush any pending output so that it is not duplicated by the writer
+  std::cout.flush();
+  std::cerr.flush();
+  fflush(0);
+
+  pid_t pid = fork();
+  if(pid < 0) {
+    LOG("Ntp", pERROR) 
+      << "Could not fork the writer process: " << strerror(errno);
+    close(fd[0]);
+    close(fd[1]);
+    return false;
+  }
+
+  if(pid == 0) {
+    // writer process
+    close(fd[1]);
+    this->InitOutput();
+    bool ok = this->RunAsyncWriter(fd[0]);
+    close(fd[0]);
+    ok = this->SaveOutput() && ok;
+    std::cout.flush();
+    std::cerr.flush();
+    fflush(0);
+    _exit(ok ? 0 : 1);
+  }
+
+  // main process: the write end of the pipe is non-blocking so that events
+  // are buffered while the writer is busy
+  close(fd[0]);
+  fcntl(fd[1], F_SETFL, fcntl(fd[1], F_GETFL) | O_NONBLOCK);
+
+  fAsyncPid    = pid;
+  fAsyncFd     = fd[1];
+  fAsyncBufPos = 0;
+  fAsyncBuf.clear();
+  fAsyncFailed = false;
+
+  LOG("Ntp", pNOTICE) 
+    << "Writing " << fOutFilename << " in writer process " << pid
+    << " (max buffered: " << fAsyncBufSize << " bytes)";
+
+  return true;
+}
+//____________________________________________________________________________
+bool NtpWriter::RunAsyncWriter(int fd)
+{
+// Read events (a 4-byte length followed by a serialized NtpMCEventRecord)
+// from the pipe and add them to the event tree
+
+  vector<char> msg;
+  Long64_t nev = 0;
+
+  while(1) {
+    UInt_t len = 0;
+    size_t n = this->ReadAsync(fd, (char *) &len, sizeof(UInt_t));
+    if(n == 0) break; // the main process closed the pipe
+    if(n == sizeof(UInt_t)) {
+      if(msg.size() < len) msg.resize(len);
+      n = this->ReadAsync(fd, &msg[0], len);
+    }
+    if(n != len || len == 0) {
+      LOG("Ntp", pERROR) << "Truncated input after " << nev << " events";
+      return false;
+    }
+
+    TBufferFile buf(TBuffer::kRead, len, &msg[0], kFALSE);
+    fNtpMCEventRecord = (NtpMCEventRecord *) 
+         buf.ReadObjectAny(NtpMCEventRecord::Class());
+    if(!fNtpMCEventRecord) {
+      LOG("Ntp", pERROR) << "Could not read event after " << nev << " events";
+      return false;
+    }
+    if(fNtpFormat == kNFFlat) {
+      fNtpMCFlatRecord->Fill(fNtpMCEventRecord->hdr.ievent, 
+                             fNtpMCEventRecord->event);
+    } else {
+      fNtpMCEventSummary->Fill(fNtpMCEventRecord->event);
+    }
+    fOutTree->Fill();
+    delete fNtpMCEventRecord;
+    fNtpMCEventRecord = 0;
+    nev++;
   }
+
+  LOG("Ntp", pINFO) << "Writer process added " << nev << " events";
+  return true;
 }
 //____________________________________________________________________________
+size_t NtpWriter::ReadAsync(int fd, char * buf, size_t nbytes)
+{
+// Read nbytes from the pipe. Returns fewer bytes only at end of input.
+
+  size_t nread = 0;
+  while(nread < nbytes) {
+    ssize_t n = read(fd, buf + nread, nbytes - nread);
+    if(n > 0) nread += n;
+    else if(n == 0) break;
+    else if(errno != EINTR) {
+      LOG("Ntp", pERROR) 
+        << "Could not read from the main process: " << strerror(errno);
+      break;
+    }
+  }
+  return nread;
+}
+//____________________________________________________________________________
+void NtpWriter::WriteAsyncBuffer(bool drain)
+{
+// Send buffered events to the writer process. Returns as soon as the pipe is
+// full, unless more than fAsyncBufSize bytes are still buffered or the
+// buffer is to be drained, in which case it waits for the writer.
+// SIGPIPE is ignored while writing (and the previous handler is restored at
+// the end), so that a writer process that died is reported as a write error
+// rather than terminating the job.
+
+  if(fAsyncFailed) return;
+
+  struct sigaction sig_ignore, sig_prev;
+  memset(&sig_ignore, 0, sizeof(sig_ignore));
+  sig_ignore.sa_handler = SIG_IGN;
+  sigemptyset(&sig_ignore.sa_mask);
+  sigaction(SIGPIPE, &sig_ignore, &sig_prev);
+
+  while(fAsyncBufPos < fAsyncBuf.size()) {
+    ssize_t n = write(fAsyncFd, 
+          &fAsyncBuf[fAsyncBufPos], fAsyncBuf.size() - fAsyncBufPos);
+    if(n > 0) {
+      fAsyncBufPos += n;
+      continue;
+    }
+    if(n < 0 && errno == EINTR) continue;
+    if(n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      unsigned int nbuffered = fAsyncBuf.size() - fAsyncBufPos;
+      if(!drain && nbuffered <= fAsyncBufSize) break;
+      struct pollfd pfd;
+      pfd.fd     = fAsyncFd;
+      pfd.events = POLLOUT;
+      poll(&pfd, 1, -1);
+      continue;
+    }
+    LOG("Ntp", pERROR) 
+       << "Could not send events to the writer process: " << strerror(errno);
+    fAsyncFailed = true;
+    fAsyncBufPos = fAsyncBuf.size();
+    break;
+  }
 
+  sigaction(SIGPIPE, &sig_prev, 0);
+
+  // drop what was sent
+  if(fAsyncBufPos == fAsyncBuf.size()) {
+    fAsyncBuf.clear();
+    fAsyncBufPos = 0;
+  } else if(fAsyncBufPos > fAsyncBuf.size()/2) {
+    fAsyncBuf.erase(fAsyncBuf.begin(), fAsyncBuf.begin() + fAsyncBufPos);
+    fAsyncBufPos = 0;
+  }
+}
+//____________________________________________________________________________
+bool NtpWriter::StopAsyncWriter(void)
+{
+// Send the remaining events, close the pipe and wait for the writer process
+// to save the output. Returns false if any event could not be saved.
+
+  LOG("Ntp", pINFO) << "Waiting for the writer process to save the output";
+
+  this->WriteAsyncBuffer(true);
+  close(fAsyncFd);
+  fAsyncFd = -1;
+
+  int status = 0;
+  while(waitpid(fAsyncPid, &status, 0) < 0 && errno == EINTR) { }
+  fAsyncPid = -1;
+
+  if(fAsyncFailed || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    LOG("Ntp", pERROR) 
+       << "The writer process failed to save " << fOutFilename;
+    return false;
+  }
+  return true;
+}
+//____________________________________________________________________________
@@ -6,6 +6,26 @@
 \brief   A utility class to facilitate creating the GENIE MC Ntuple from the
          output GENIE GHEP event records.
 
+         Events can be written either as full GHEP records (kNFGHEP) or as
+         flat columnar summaries (kNFFlat, see NtpMCFlatRecord), which are
+         written directly at generation time rather than in a second pass.
+         GHEP trees also carry a few summary columns (see NtpMCEventSummary)
+         for selecting events without deserializing their GHEP record.
+
+         The writer can optionally run in asynchronous mode (see
+         EnableAsyncOutput()): The ROOT file and event tree are then owned
+         by a writer process forked at Initialize(). Each added event is
+         serialized (as a NtpMCEventRecord) into a bounded in-memory buffer
+         which is streamed to the writer process over a pipe. TTree::Fill(),
+         basket compression and autosaves happen in the writer process, so
+         event generation does not stall while baskets are flushed. Event
+         generation is only held back (back-pressure) when the writer falls
+         behind by more than the buffer size. Save() waits for the writer
+         to drain the buffer and close the file, and returns false if the
+         writer process failed. In asynchronous mode the event tree is not
+         accessible via EventTree(), so clients that add their own branches
+         or merge files with AddEventRecords() must use the synchronous mode.
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          STFC, Rutherford Appleton Laboratory
 
@@ -21,6 +41,7 @@
 #define _NTP_WRITER_H_
 
 #include <string>
+#include <vector>
 
 #include "Ntuple/NtpMCFormat.h"
 
@@ -30,11 +51,14 @@ class TBranch;
 class TClonesArray;
 
 using std::string;
+using std::vector;
 
 namespace genie {
 
 class EventRecord;
 class NtpMCEventRecord;
+class NtpMCEventSummary;
+class NtpMCFlatRecord;
 class NtpMCTreeHeader;
 
 class NtpWriter {
@@ -49,8 +73,21 @@ public :
   ///< add event
   void AddEventRecord (int ievent, const EventRecord * ev_rec);
 
-  ///< save the event tree
-  void Save (void);
+  ///< add all events found in another GHEP file (eg the output of an
+  ///< event generation worker), keeping their original event numbers
+  bool AddEventRecords (string filename);
+
+  ///< save the event tree (returns false if the output could not be saved)
+  bool Save (void);
+
+  ///< use before Initialize() only: fill and save the event tree in a
+  ///< separate writer process, buffering up to buf_size bytes of events
+  void EnableAsyncOutput (bool enable, unsigned int buf_size = 50000000);
+
+  ///< use before Initialize() only if you wish to override the ROOT
+  ///< default compression algorithm & level, or the event branch basket size
+  void SetCompression (int algorithm, int level);
+  void SetBasketSize  (int basket_size);
 
   ///< get the even tree
   TTree *  EventTree (void) { return fOutTree; }  
@@ -68,6 +105,14 @@ private:
   void CreateTreeHeader      (void);
   void CreateEventBranch     (void);
   void CreateGHEPEventBranch (void);
+  void CreateFlatEventBranches (void);
+  void InitOutput            (void);
+  bool SaveOutput            (void);
+  bool StartAsyncWriter      (void);
+  bool RunAsyncWriter        (int fd);
+  size_t ReadAsync           (int fd, char * buf, size_t nbytes);
+  void WriteAsyncBuffer      (bool drain);
+  bool StopAsyncWriter       (void);
 
   NtpMCFormat_t      fNtpFormat;          ///< enumeration of event formats
   Long_t             fRunNu;              ///< run nu
@@ -76,7 +121,19 @@ private:
   TTree *            fOutTree;            ///< output tree
   TBranch *          fEventBranch;        ///< the generated event branch 
   NtpMCEventRecord * fNtpMCEventRecord;   ///< 
+  NtpMCFlatRecord *  fNtpMCFlatRecord;    ///< flat record (kNFFlat format only)
+  NtpMCEventSummary * fNtpMCEventSummary; ///< summary columns (kNFGHEP format only)
   NtpMCTreeHeader *  fNtpMCTreeHeader;    ///<
+  int                fCompressAlg;        ///< compression algorithm (-1: ROOT default)
+  int                fCompressLevel;      ///< compression level (-1: ROOT default)
+  int                fBasketSize;         ///< event branch basket size
+  bool               fAsync;              ///< fill the event tree in a writer process?
+  unsigned int       fAsyncBufSize;       ///< max bytes buffered before applying back-pressure
+  int                fAsyncPid;           ///< process id of the writer process
+  int                fAsyncFd;            ///< pipe to the writer process
+  vector<char>       fAsyncBuf;           ///< serialized events not yet sent to the writer
+  unsigned int       fAsyncBufPos;        ///< position of first unsent byte in fAsyncBuf
+  bool               fAsyncFailed;        ///< could not send events to the writer process?
 };
 
 }      // genie namespace
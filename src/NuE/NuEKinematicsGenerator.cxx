@@ -230,13 +230,13 @@ double NuEKinematicsGenerator::Energy(const Interaction * interaction) const
 //___________________________________________________________________________
 void NuEKinematicsGenerator::Configure(const Registry & config)
 {
-  Algorithm::Configure(config);
+  KineGeneratorWithCache::Configure(config);
   this->LoadConfig();
 }
 //____________________________________________________________________________
 void NuEKinematicsGenerator::Configure(string config)
 {
-  Algorithm::Configure(config);
+  KineGeneratorWithCache::Configure(config);
   this->LoadConfig();
 }
 //____________________________________________________________________________
@@ -30,7 +30,7 @@
 #include "PDG/PDGCodes.h"
 #include "PDG/PDGUtils.h"
 #include "PDG/PDGLibrary.h"
-#include "Utils/NuclearUtils.h"
+#include "Utils/NuclearDensityTable.h"
 #include "Utils/PrintUtils.h"
 #include "NucleonDecay/NucleonDecayPrimaryVtxGenerator.h"
 #include "NucleonDecay/NucleonDecayUtils.h"
@@ -179,52 +179,22 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayedNucleonPosition(
   LOG("NucleonDecay", pINFO)
       << "Generating vertex according to a realistic nuclear density profile";
 
-  // get inputs to the rejection method
-  double ymax = -1;
+  // select a radial position by inverting the (tabulated) cumulative
+  // distribution of r^2*density
+  NuclearDensityTable * dtbl = NuclearDensityTable::Instance();
   double rmax = 3*R;
-  double dr   = R/40.;
-  for(double r = 0; r < rmax; r+=dr) {
-      ymax = TMath::Max(ymax, r*r * utils::nuclear::Density(r,A));
-  }
-  ymax *= 1.2;
-  
-  // select a vertex using the rejection method 
-  TLorentzVector vtx(0,0,0,0);
-  unsigned int iter = 0;
-  while(1) {
-    iter++;
+  double r    = dtbl->SelectRadius(A, rmax, rnd->RndFsi().Rndm());
 
-    // throw an exception if it hasn't find a solution after many attempts
-    if(iter > controls::kRjMaxIterations) {
-       LOG("NucleonDecay", pWARN)
-           << "Couldn't generate a vertex position after " << iter << " iterations";
-       genie::exceptions::EVGThreadException exception;
-       exception.SetReason("Couldn't generate vertex");
-       exception.SwitchOnFastForward();
-       throw exception;
-    }
-           
-    double r = rmax * rnd->RndFsi().Rndm();
-    double t = ymax * rnd->RndFsi().Rndm();
-    double y = r*r * utils::nuclear::Density(r,A);
-    if(y > ymax) {   
-       LOG("NucleonDecay", pERROR)
-          << "y = " << y << " > ymax = " << ymax << " for r = " << r << ", A = " << A;
-    }
-    bool accept = (t < y);
-    if(accept) {
-       double phi      = 2*constants::kPi * rnd->RndFsi().Rndm();
-       double cosphi   = TMath::Cos(phi);
-       double sinphi   = TMath::Sin(phi);
-       double costheta = -1 + 2 * rnd->RndFsi().Rndm();
-       double sintheta = TMath::Sqrt(1-costheta*costheta);
-       vtx.SetX(r*sintheta*cosphi);
-       vtx.SetY(r*sintheta*sinphi);
-       vtx.SetZ(r*costheta);
-       vtx.SetT(0.);
-       break;
-    }
-  } // while 1
+  TLorentzVector vtx(0,0,0,0);
+  double phi      = 2*constants::kPi * rnd->RndFsi().Rndm();
+  double cosphi   = TMath::Cos(phi);
+  double sinphi   = TMath::Sin(phi);
+  double costheta = -1 + 2 * rnd->RndFsi().Rndm();
+  double sintheta = TMath::Sqrt(1-costheta*costheta);
+  vtx.SetX(r*sintheta*cosphi);
+  vtx.SetY(r*sintheta*sinphi);
+  vtx.SetZ(r*costheta);
+  vtx.SetT(0.);
 
   GHepParticle * decayed_nucleon = event->Particle(1);
   assert(decayed_nucleon);
@@ -327,56 +297,21 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayProducts(
      throw exception;
   }
 
-  // Get the maximum weight
-  //double wmax = fPhaseSpaceGenerator.GetWtMax();
-  double wmax = -1;
-  for(int i=0; i<200; i++) {
-     double w = fPhaseSpaceGenerator.Generate();   
-     wmax = TMath::Max(wmax,w);
-  }
-  assert(wmax>0);
-  wmax *= 2;
-
-  LOG("NucleonDecay", pNOTICE) 
-     << "Max phase space gen. weight @ current hadronic system: " << wmax;
-
-  // Generate an unweighted decay
+  // Generate an unweighted decay, using the tabulated max weight
   RandomGen * rnd = RandomGen::Instance();
-
-  bool accept_decay=false;
-  unsigned int itry=0;
-  while(!accept_decay) 
-  {
-     itry++;
-
-     if(itry > controls::kMaxUnweightDecayIterations) {
-       // report, clean-up and return
-       LOG("NucleonDecay", pWARN) 
-           << "Couldn't generate an unweighted phase space decay after " 
-           << itry << " attempts";
-       // clean up
-       delete [] mass;
-       delete p4d;
-       delete v4d;
-       // throw exception
-       genie::exceptions::EVGThreadException exception;
-       exception.SetReason("Couldn't select decay after N attempts");
-       exception.SwitchOnFastForward();
-       throw exception;
-     }
-     double w  = fPhaseSpaceGenerator.Generate();   
-     if(w > wmax) {
-        LOG("NucleonDecay", pWARN) 
-           << "Decay weight = " << w << " > max decay weight = " << wmax;
-     }
-     double gw = wmax * rnd->RndHadro().Rndm();
-     accept_decay = (gw<=w);
-
-     LOG("NucleonDecay", pINFO) 
-        << "Decay weight = " << w << " / R = " << gw 
-        << " - accepted: " << accept_decay;
-
-  } //!accept_decay
+  bool accept_decay = 
+     fPhaseSpaceGenerator.GenerateUnweighted(rnd->RndHadro(), 2.);
+  if(!accept_decay) {
+     // clean up
+     delete [] mass;
+     delete p4d;
+     delete v4d;
+     // throw exception
+     genie::exceptions::EVGThreadException exception;
+     exception.SetReason("Couldn't select decay after N attempts");
+     exception.SwitchOnFastForward();
+     throw exception;
+  }
 
   // Insert final state products into a TClonesArray of TMCParticles
   TLorentzVector v4(*v4d); 
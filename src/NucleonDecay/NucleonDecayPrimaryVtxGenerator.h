@@ -19,10 +19,9 @@
 #ifndef _NUCLEON_DECAY_PRIMARY_VTX_GENERATOR_H_
 #define _NUCLEON_DECAY_PRIMARY_VTX_GENERATOR_H_
 
-#include <TGenPhaseSpace.h>
-
 #include "EVGCore/EventRecordVisitorI.h"
 #include "NucleonDecay/NucleonDecayMode.h"
+#include "Utils/NBodyPhaseSpace.h"
 
 namespace genie {
 
@@ -54,7 +53,7 @@ private:
    mutable int                fCurrInitStatePdg;
    mutable NucleonDecayMode_t fCurrDecayMode;
    mutable bool               fNucleonIsBound;
-   mutable TGenPhaseSpace     fPhaseSpaceGenerator;
+   mutable NBodyPhaseSpace    fPhaseSpaceGenerator;
 
    const NuclearModelI * fNuclModel;
 };
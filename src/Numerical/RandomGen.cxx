@@ -73,7 +73,10 @@ RandomGen::RandomGen()
 RandomGen::~RandomGen()
 {
   fInstance = 0;
-  if(fRandom3) delete fRandom3;
+  for(int i = 0; i < kNRndStreams; i++) {
+    if(fRandom3[i]) delete fRandom3[i];
+    fRandom3[i] = 0;
+  }
 }
 //____________________________________________________________________________
 RandomGen * RandomGen::Instance()
@@ -96,18 +99,19 @@ void RandomGen::SetSeed(long int seed)
      << ((fInitalized) ? ": " : " at random number generator initialization: ")
      << seed;
 
-  // Set the seed number for all internal GENIE random number generators
-  this->RndKine ().SetSeed(seed);
-  this->RndHadro().SetSeed(seed);
-  this->RndDec  ().SetSeed(seed); 
-  this->RndFsi  ().SetSeed(seed);
-  this->RndLep  ().SetSeed(seed);
-  this->RndISel ().SetSeed(seed);
-  this->RndGeom ().SetSeed(seed);
-  this->RndFlux ().SetSeed(seed);
-  this->RndEvg  ().SetSeed(seed);
-  this->RndNum  ().SetSeed(seed); 
-  this->RndGen  ().SetSeed(seed);
+  fJobSeed = seed;
+  this->SetStreamSeed(seed);
+}
+//____________________________________________________________________________
+void RandomGen::SetStreamSeed(long int seed)
+{
+  fCurrSeed = seed;
+
+  // Set the seed number for all internal GENIE random number generators.
+  // Each stream gets a different seed derived from the input one.
+  for(int i = 0; i < kNRndStreams; i++) {
+    fRandom3[i]->SetSeed(this->StreamSeed(seed, 0, -1, i));
+  }
 
   // Set the seed number for ROOT's gRandom
   gRandom ->SetSeed (seed);
@@ -131,9 +135,56 @@ void RandomGen::SetSeed(long int seed)
   LOG("Rndm", pINFO) << "PYTHIA6  seed = " << pythia6->GetMRPY(1);
 }
 //____________________________________________________________________________
+void RandomGen::SetEventKey(long int run, long int event)
+{
+  LOG("Rndm", pDEBUG) 
+     << "Re-seeding random number streams for run: " << run 
+     << ", event: " << event;
+
+  for(int i = 0; i < kNRndStreams; i++) {
+    fRandom3[i]->SetSeed(this->StreamSeed(fJobSeed, run, event, i));
+  }
+
+  // ROOT's gRandom is used by TGenPhaseSpace in the hadronization and
+  // decay models, so it is keyed as well
+  gRandom->SetSeed(this->StreamSeed(fJobSeed, run, event, kNRndStreams));
+
+  // PYTHIA6 seed must be in [0, 900000000]. Setting MRPY(2) to 0 forces
+  // PYTHIA6 to re-initialize its generator from MRPY(1) at the next call.
+  TPythia6 * pythia6 = TPythia6::Instance();
+  pythia6->SetMRPY(1, 
+    this->StreamSeed(fJobSeed, run, event, kNRndStreams+1) % 900000000);
+  pythia6->SetMRPY(2, 0);
+}
+//____________________________________________________________________________
+UInt_t RandomGen::StreamSeed(
+         long int seed, long int run, long int event, int stream) const
+{
+// Derives a 32-bit seed from (seed, run, event, stream) by chaining the 
+// SplitMix64 finalizer. Nearby keys are mapped to uncorrelated seeds.
+
+  ULong64_t key[4] = { 
+     (ULong64_t) seed, (ULong64_t) run, (ULong64_t) event, (ULong64_t) stream };
+
+  ULong64_t h = 0;
+  for(int i = 0; i < 4; i++) {
+    h ^= key[i];
+    h += 0x9E3779B97F4A7C15ULL;
+    h  = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    h  = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+    h  =  h ^ (h >> 31);
+  }
+
+  // a seed of 0 would make TRandom3 pick a time-dependent seed
+  UInt_t s = (UInt_t) (h >> 32);
+  return (s == 0) ? 1 : s;
+}
+//____________________________________________________________________________
 void RandomGen::InitRandomGenerators(long int seed)
 {
-  fRandom3 = new TRandom3();
+  for(int i = 0; i < kNRndStreams; i++) {
+    fRandom3[i] = new TRandom3();
+  }
   this->SetSeed(seed);
 }
 //____________________________________________________________________________
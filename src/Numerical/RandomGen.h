@@ -35,67 +35,98 @@ public:
   static RandomGen * Instance();
 
   //! Random number generators used by various GENIE modules.
-  //! (See note at http://root.cern.ch/root/html//TRandom.html
-  //!  on using several TRandom objects each with each own
-  //!  "independent" run sequence).
-
-  //! At this point, since the actual random number generator
-  //! periodicity is very high, all the generators are in fact one!
-  //! However, the option to use many generators is reserved.
+  //! Each generation stage has its own, independent, random number stream
+  //! so that changing the number of random numbers drawn by one module does
+  //! not perturb the random number sequence seen by the other modules.
+  //! The seed of each stream is derived from the job seed number by hashing
+  //! it with the stream id. The streams can also be re-seeded at the start
+  //! of every event from a (run, event, stream) key, see SetEventKey().
 
   //! Currently, the preferred generator is the "Mersenne Twister"
   //! with a periodicity of 10**6000
   //! See: http://root.cern.ch/root/html/TRandom3.html
 
   //! rnd number generator used by kinematics generators
-  TRandom3 & RndKine (void) const { return *fRandom3; } 
+  TRandom3 & RndKine (void) const { return *fRandom3[kRndKine]; } 
 
   //! rnd number generator used by hadronization models 
-  TRandom3 & RndHadro (void) const { return *fRandom3; }
+  TRandom3 & RndHadro (void) const { return *fRandom3[kRndHadro]; }
 
   //! rnd number generator used by decay models 
-  TRandom3 & RndDec (void) const { return *fRandom3; }
+  TRandom3 & RndDec (void) const { return *fRandom3[kRndDec]; }
 
   //! rnd number generator used by intranuclear cascade monte carlos
-  TRandom3 & RndFsi (void) const { return *fRandom3; }
+  TRandom3 & RndFsi (void) const { return *fRandom3[kRndFsi]; }
 
   //! rnd number generator used by final state primary lepton generators
-  TRandom3 & RndLep (void) const { return *fRandom3; } 
+  TRandom3 & RndLep (void) const { return *fRandom3[kRndLep]; } 
 
   //! rnd number generator used by interaction selectors
-  TRandom3 & RndISel (void) const { return *fRandom3; }
+  TRandom3 & RndISel (void) const { return *fRandom3[kRndISel]; }
 
   //! rnd number generator used by geometry drivers
-  TRandom3 & RndGeom (void) const { return *fRandom3; }
+  TRandom3 & RndGeom (void) const { return *fRandom3[kRndGeom]; }
 
   //! rnd number generator used by flux drivers
-  TRandom3 & RndFlux (void) const { return *fRandom3; }
+  TRandom3 & RndFlux (void) const { return *fRandom3[kRndFlux]; }
 
   //! rnd number generator used by the event generation drivers
-  TRandom3 & RndEvg (void) const { return *fRandom3; }
+  TRandom3 & RndEvg (void) const { return *fRandom3[kRndEvg]; }
 
   //! rnd number generator used by MC integrators & other numerical methods
-  TRandom3 & RndNum (void) const { return *fRandom3; }
+  TRandom3 & RndNum (void) const { return *fRandom3[kRndNum]; }
 
   //! rnd number generator for generic usage
-  TRandom3 & RndGen  (void) const { return *fRandom3; }
+  TRandom3 & RndGen  (void) const { return *fRandom3[kRndGen]; }
 
   long int GetSeed (void)         const { return fCurrSeed; }
   void     SetSeed (long int seed);
 
+  //! Re-seed the random number streams without changing the job seed number
+  //! used by SetEventKey() (eg in parallel workers that need their own
+  //! random number sequences but must generate the same events as a single
+  //! process would)
+  void     SetStreamSeed (long int seed);
+  long int GetJobSeed    (void) const { return fJobSeed; }
+
+  //! Re-seed all random number streams (and PYTHIA6) from a key built from
+  //! the job seed number, the input run and event numbers and the stream id.
+  //! Calling it at the start of each event makes every event reproducible on
+  //! its own, independently of the events generated before it, and allows
+  //! splitting a run across processes or nodes without correlations.
+  void     SetEventKey (long int run, long int event);
+
 private:
 
+  //! Random number stream ids
+  enum ERndStream {
+    kRndKine = 0,
+    kRndHadro,
+    kRndDec,
+    kRndFsi,
+    kRndLep,
+    kRndISel,
+    kRndGeom,
+    kRndFlux,
+    kRndEvg,
+    kRndNum,
+    kRndGen,
+    kNRndStreams
+  };
+
   RandomGen();
   RandomGen(const RandomGen & rgen);
   virtual ~RandomGen();
 
   static RandomGen * fInstance;
 
-  TRandom3 * fRandom3;    ///< Mersenne Twistor
+  TRandom3 * fRandom3[kNRndStreams]; ///< Mersenne Twistor, one per stream
   long int   fCurrSeed;   ///< random number generator seed number
+  long int   fJobSeed;    ///< job seed number, used for keying events
   bool       fInitalized; ///< done initializing singleton?
 
-  void InitRandomGenerators(long int seed);
+  void     InitRandomGenerators (long int seed);
+  UInt_t   StreamSeed           (long int seed, long int run, long int event, int stream) const;
 
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
@@ -28,6 +28,7 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstring>
 #include <iomanip>
 #include <cfloat>
 
@@ -387,30 +388,8 @@ double Spline::Evaluate(double x) const
 
     // we can interpolate within the range of spline knots - be careful with
     // strange cubic spline behaviour when close to knots with y=0
-    bool is0p = this->ClosestKnotValueIsZero(x, "+");
-    bool is0n = this->ClosestKnotValueIsZero(x, "-");
-
-    if(!is0p && !is0n) {
-      // both knots (on the left and right are non-zero) - just interpolate
-      LOG("Spline", pDEBUG) << "Point is between non-zero knots";
-      y = fInterpolator->Eval(x);
-    } else {
-      // at least one of the neighboring knots has y=0
-      if(is0p && is0n) {
-        // both neighboring knots have y=0
-        LOG("Spline", pDEBUG) << "Point is between zero knots";
-        y=0;
-      } else {
-        // just 1 neighboring knot has y=0 - do a linear interpolation
-        LOG("Spline", pDEBUG) 
-          << "Point has zero" << (is0n ? " left " : " right ") << "knot";
-        double xpknot=0, ypknot=0, xnknot=0, ynknot=0;
-        this->FindClosestKnot(x, xnknot, ynknot, "-");
-        this->FindClosestKnot(x, xpknot, ypknot, "+");
-        if(is0n) y = ypknot * (x-xnknot)/(xpknot-xnknot);
-        else     y = ynknot * (x-xnknot)/(xpknot-xnknot);
-      }
-    }
+    int iknot = -1;
+    y = this->Interpolate(x, iknot);
 
   } else {
     LOG("Spline", pDEBUG) << "x = " << x
@@ -428,6 +407,22 @@ double Spline::Evaluate(double x) const
   return y;
 }
 //___________________________________________________________________________
+void Spline::Evaluate(const double * x, double * y, int n) const
+{
+// Evaluate the spline at the n points of the input x array and store the
+// results in the output y array. Gives identical results to Evaluate(double)
+// but without any logging. The knot found for each point is used as the
+// starting guess for the next one, so it is best to pass x sorted.
+
+  if((int)fKnotX.size() != fNKnots) this->BuildKnotArrays();
+
+  int iknot = -1;
+  for(int i = 0; i < n; i++) {
+    assert(!TMath::IsNaN(x[i]));
+    y[i] = (this->IsWithinValidRange(x[i])) ? this->Interpolate(x[i], iknot) : 0.;
+  }
+}
+//___________________________________________________________________________
 void Spline::SaveAsXml(
                 string filename, string xtag, string ytag, string name) const
 {
@@ -550,18 +545,19 @@ TGraph * Spline::GetAsTGraph(
 void Spline::FindClosestKnot(
               double x, double & xknot, double & yknot, Option_t * opt) const
 {
-  string option(opt);
-
-  bool pos = (option.find("+") != string::npos);
-  bool neg = (option.find("-") != string::npos);
+  bool pos = (strchr(opt, '+') != 0);
+  bool neg = (strchr(opt, '-') != 0);
 
   if(!pos && !neg) return;
 
-  int iknot = fInterpolator->FindX(x);
+  if((int)fKnotX.size() != fNKnots) this->BuildKnotArrays();
+  if(fKnotX.empty()) return;
+
+  int iknot  = this->FindKnot(x);
+  int iknotp = TMath::Min(iknot+1, fNKnots-1);
 
-  double xp=0, yp=0, xn=0, yn=0;
-  fInterpolator->GetKnot(iknot,  xn,yn);
-  fInterpolator->GetKnot(iknot+1,xp,yp);
+  double xn = fKnotX[iknot],  yn = fKnotCoeff[4*iknot];
+  double xp = fKnotX[iknotp], yp = fKnotCoeff[4*iknotp];
 
   bool p = (TMath::Abs(x-xp) < TMath::Abs(x-xn));
 
@@ -576,10 +572,22 @@ void Spline::FindClosestKnot(
 //___________________________________________________________________________
 bool Spline::ClosestKnotValueIsZero(double x, Option_t * opt) const
 {
-  double xknot = 0, yknot = 0;
-  this->FindClosestKnot(x, xknot, yknot, opt);
-  if(utils::math::AreEqual(yknot,0)) return true;
-  return false;
+  bool pos = (strchr(opt, '+') != 0);
+  bool neg = (strchr(opt, '-') != 0);
+
+  if((int)fKnotX.size() != fNKnots) this->BuildKnotArrays();
+
+  // nothing to look at: no knot selected or no knots at all
+  if((!pos && !neg) || fKnotX.empty()) return true;
+
+  int iknot  = this->FindKnot(x);
+  int iknotp = TMath::Min(iknot+1, fNKnots-1);
+
+  if(pos&&neg) {
+    bool p = (TMath::Abs(x-fKnotX[iknotp]) < TMath::Abs(x-fKnotX[iknot]));
+    return (p) ? fKnotIsZero[iknotp] : fKnotIsZero[iknot];
+  }
+  return (pos) ? fKnotIsZero[iknotp] : fKnotIsZero[iknot];
 }
 //___________________________________________________________________________
 void Spline::Print(ostream & stream) const
@@ -756,6 +764,10 @@ void Spline::ResetSpline(void)
 {
   if(fInterpolator) delete fInterpolator;
   this->InitSpline();
+
+  fKnotX.clear();
+  fKnotCoeff.clear();
+  fKnotIsZero.clear();
 }
 //___________________________________________________________________________
 void Spline::BuildSpline(int nentries, double x[], double y[])
@@ -774,6 +786,102 @@ void Spline::BuildSpline(int nentries, double x[], double y[])
 
   fInterpolator = new TSpline3("spl3", x, y, nentries, "0");
 
+  this->BuildKnotArrays();
+
   LOG("Spline", pDEBUG) << "...done building spline";
 }
 //___________________________________________________________________________
+void Spline::BuildKnotArrays(void) const
+{
+// Copy the TSpline3 knots and polynomial coefficients into flat arrays.
+// Called whenever the spline is built and, since these arrays are not
+// persistent, before the first evaluation of a spline read from a file.
+
+  fKnotX.clear();
+  fKnotCoeff.clear();
+  fKnotIsZero.clear();
+
+  if(!fInterpolator) return;
+
+  int n = fInterpolator->GetNp();
+
+  fKnotX.resize(n);
+  fKnotCoeff.resize(4*n);
+  fKnotIsZero.resize(n);
+
+  for(int i = 0; i < n; i++) {
+    double x=0, y=0, b=0, c=0, d=0;
+    fInterpolator->GetCoeff(i, x, y, b, c, d);
+    fKnotX     [i]     = x;
+    fKnotCoeff [4*i  ] = y;
+    fKnotCoeff [4*i+1] = b;
+    fKnotCoeff [4*i+2] = c;
+    fKnotCoeff [4*i+3] = d;
+    fKnotIsZero[i]     = utils::math::AreEqual(y,0);
+  }
+}
+//___________________________________________________________________________
+int Spline::FindKnot(double x, int hint) const
+{
+// Find the knot at the start of the interval containing x. Same convention
+// as TSpline3::FindX(): x(iknot) < x <= x(iknot+1). If the input hint knot
+// satisfies it, the binary search is skipped.
+
+  int n = (int) fKnotX.size();
+
+  if(x <= fKnotX[0]  ) return 0;
+  if(x >= fKnotX[n-1]) return n-1;
+
+  if(hint >= 0 && hint < n-1) {
+    if(fKnotX[hint] < x && x <= fKnotX[hint+1]) return hint;
+  }
+
+  int klow = 0;
+  int khig = n-1;
+  while(khig-klow > 1) {
+    int khalf = (klow+khig)/2;
+    if(x > fKnotX[khalf]) klow = khalf;
+    else                  khig = khalf;
+  }
+  return klow;
+}
+//___________________________________________________________________________
+double Spline::Interpolate(double x, int & iknot) const
+{
+// Interpolate at x (within the valid range). The input iknot is used as a
+// hint and is set to the knot at the start of the interval containing x.
+// Uses the same arithmetic as TSpline3::Eval() so the results are identical.
+
+  if((int)fKnotX.size() != fNKnots) this->BuildKnotArrays();
+  if(fKnotX.empty()) return 0;
+
+  int n = (int) fKnotX.size();
+
+  iknot = this->FindKnot(x, iknot);
+
+  // at the last knot
+  if(iknot >= n-1) return fKnotCoeff[4*(n-1)];
+
+  bool is0n = fKnotIsZero[iknot];
+  bool is0p = fKnotIsZero[iknot+1];
+
+  // both knots (on the left and right are non-zero) - just interpolate
+  if(!is0n && !is0p) {
+    const double * c = &fKnotCoeff[4*iknot];
+    double dx = x - fKnotX[iknot];
+    return (c[0] + dx*(c[1] + dx*(c[2] + dx*c[3])));
+  }
+
+  // both neighboring knots have y=0
+  if(is0n && is0p) return 0;
+
+  // just 1 neighboring knot has y=0 - do a linear interpolation
+  double xn = fKnotX[iknot];
+  double xp = fKnotX[iknot+1];
+  double yn = fKnotCoeff[4*iknot];
+  double yp = fKnotCoeff[4*(iknot+1)];
+
+  if(is0n) return yp * (x-xn)/(xp-xn);
+  return yn * (x-xn)/(xp-xn);
+}
+//___________________________________________________________________________
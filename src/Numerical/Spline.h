@@ -9,6 +9,11 @@
           function (x,y(x)) pairs from an XML file, a flat ascii file, a
           TNtuple, a TTree or an SQL database.
 
+          The TSpline3 knots and cubic polynomial coefficients are also kept
+          in flat arrays, together with a mask of the knots with y=0, so
+          that the spline can be evaluated (one point at a time or for a
+          whole array of points) without going through TSpline3.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           STFC, Rutherford Appleton Laboratory
 
@@ -21,6 +26,7 @@
 #define _SPLINE_H_
 
 #include <string>
+#include <vector>
 #include <fstream>
 #include <ostream>
 
@@ -35,6 +41,7 @@ class TGraph;
 using std::string;
 using std::ostream;
 using std::ofstream;
+using std::vector;
 
 namespace genie {
 
@@ -70,6 +77,7 @@ public:
   double XMax               (void) const {return fXMax;  }
   double YMax               (void) const {return fYMax;  }
   double Evaluate           (double x) const;
+  void   Evaluate           (const double * x, double * y, int n) const;
   bool   IsWithinValidRange (double x) const;
 
   void   SetName (string name) { fName = name; }
@@ -114,6 +122,11 @@ private:
   void ResetSpline (void);
   void BuildSpline (int nentries, double x[], double y[]);
 
+  //-- fast evaluation using the flat knot & coefficient arrays
+  void   BuildKnotArrays (void) const;
+  int    FindKnot        (double x, int hint = -1) const;
+  double Interpolate     (double x, int & iknot) const;
+
   //-- private data members
   string     fName;
   int        fNKnots;
@@ -123,6 +136,10 @@ private:
   TSpline3 * fInterpolator;
   bool       fYCanBeNegative;
 
+  mutable vector<double> fKnotX;      //! knot x values
+  mutable vector<double> fKnotCoeff;  //! y,b,c,d coefficients of the cubic polynomial starting at each knot
+  mutable vector<bool>   fKnotIsZero; //! is the knot y value zero?
+
 ClassDef(Spline,1)
 };
 
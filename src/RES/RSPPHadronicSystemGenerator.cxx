@@ -99,12 +99,12 @@ void RSPPHadronicSystemGenerator::AddResonanceDecayProducts(
 
   double mass[2] = { mnuc, mpi };
 
-  TLorentzVector * p4 = res->GetP4();
+  TLorentzVector p4 = *(res->P4());
 
   LOG("RESHadronicVtx", pINFO)
-                 << "\n RES 4-P = " << utils::print::P4AsString(p4);
+                 << "\n RES 4-P = " << utils::print::P4AsString(&p4);
 
-  bool is_permitted = fPhaseSpaceGenerator.SetDecay(*p4, 2, mass);
+  bool is_permitted = fPhaseSpaceGenerator.SetDecay(p4, 2, mass);
   assert(is_permitted);
 
   fPhaseSpaceGenerator.Generate();
@@ -120,7 +120,6 @@ void RSPPHadronicSystemGenerator::AddResonanceDecayProducts(
   int mom = res_pos;
   evrec->AddParticle(nuc_pdgc, ist, mom,-1,-1,-1, p4_nuc, x4);
   evrec->AddParticle(pi_pdgc,  ist, mom,-1,-1,-1, p4_pi,  x4);
-  delete p4;
 }
 //___________________________________________________________________________
 
@@ -112,7 +112,93 @@ double GReWeight::CalcWeight(const genie::EventRecord & event)
   return weight;
 }
 //____________________________________________________________________________
-double GReWeight::CalcChisq(void) 
+void GReWeight::CalcWeights(
+   const vector<const genie::EventRecord *> & events,
+   const vector<GDialPoint_t> & points, vector< vector<double> > & weights)
+{
+// Calculate the weights of a block of events for each of the input sets of
+// tweaking dial values, in a single pass over the events.
+// On return weights[i][j] is the weight of events[i] at points[j].
+// Weight calculators compute all dial-independent quantities once per event
+// (GReWeightI::CacheEvent()) and only the dial-dependent part is calculated
+// at each point. Reconfigure() is called once per point.
+// Dials not listed at a point take the values they had on entry, whatever
+// the points before it. The current tweaking dial values are restored at
+// the end.
+//
+  int nev     = events.size();
+  int npoints = points.size();
+
+  weights.assign(nev, vector<double>(npoints, 1.));
+  if(nev == 0 || npoints == 0) return;
+
+  LOG("ReW", pNOTICE)
+     << "Reweighting " << nev << " events at " << npoints << " dial points";
+
+  map<string, GReWeightI *>::iterator it;
+
+  // store the dial-independent quantities of each event
+  for(it = fWghtCalc.begin(); it != fWghtCalc.end(); ++it) {
+    GReWeightI * wcalc = it->second;
+    wcalc->ClearEventCache();
+    for(int iev = 0; iev < nev; iev++) {
+      wcalc->CacheEvent(iev, *events[iev]);
+    }
+  }
+
+  // keep the current dial values
+  GDialPoint_t curr_point;
+  vector<genie::rew::GSyst_t> svec = fSystSet.AllIncluded();
+  vector<genie::rew::GSyst_t>::const_iterator parm_iter = svec.begin();
+  for( ; parm_iter != svec.end(); ++parm_iter) {
+    curr_point[*parm_iter] = fSystSet.Info(*parm_iter)->CurValue;
+  }
+
+  for(int ip = 0; ip < npoints; ip++) {
+
+    // reset all dials to their values at entry, so that dials not listed
+    // at the current point are not left at the values of earlier points
+    GDialPoint_t::const_iterator dial_iter = curr_point.begin();
+    for( ; dial_iter != curr_point.end(); ++dial_iter) {
+      fSystSet.Set(dial_iter->first, dial_iter->second);
+    }
+
+    // set the dial values for the current point & reconfigure
+    dial_iter = points[ip].begin();
+    for( ; dial_iter != points[ip].end(); ++dial_iter) {
+      if(!fSystSet.Added(dial_iter->first)) {
+        LOG("ReW", pERROR)
+          << "Systematic param " << GSyst::AsString(dial_iter->first)
+          << " was not included in the current set - Ignoring it";
+        continue;
+      }
+      fSystSet.Set(dial_iter->first, dial_iter->second);
+    }
+    this->Reconfigure();
+
+    // event loop
+    for(int iev = 0; iev < nev; iev++) {
+      double weight = 1.0;
+      for(it = fWghtCalc.begin(); it != fWghtCalc.end(); ++it) {
+        weight *= it->second->CalcWeightCached(iev, *events[iev]);
+      }
+      weights[iev][ip] = weight;
+    }
+  }
+
+  // restore the dial values
+  GDialPoint_t::const_iterator dial_iter = curr_point.begin();
+  for( ; dial_iter != curr_point.end(); ++dial_iter) {
+    fSystSet.Set(dial_iter->first, dial_iter->second);
+  }
+  this->Reconfigure();
+
+  for(it = fWghtCalc.begin(); it != fWghtCalc.end(); ++it) {
+    it->second->ClearEventCache();
+  }
+}
+//____________________________________________________________________________
+double GReWeight::CalcChisq(void)
 {
 // calculate the sum of penalty terms for all tweaked physics parameters
 //
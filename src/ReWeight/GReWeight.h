@@ -24,12 +24,14 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 #include "ReWeight/GSystSet.h"
 #include "ReWeight/GReWeightI.h"
 
 using std::string;
 using std::map;
+using std::vector;
 
 namespace genie {
 
@@ -37,6 +39,9 @@ class EventRecord;
 
 namespace rew   {
 
+ //! a set of nuisance param values (one point of a multi-dial scan)
+ typedef map<GSyst_t, double> GDialPoint_t;
+
  class GReWeight
  {
  public:
@@ -49,6 +54,9 @@ namespace rew   {
    void        Reconfigure   (void);                             ///< reconfigure weight calculators with new params
    double      CalcWeight    (const genie::EventRecord & event); ///< calculate weight for input event
    double      CalcChisq     (void);                             ///< calculate penalty chisq for current values of tweaking dials
+   void        CalcWeights   (const vector<const genie::EventRecord *> & events,
+                              const vector<GDialPoint_t> & points,
+                              vector< vector<double> > & weights); ///< calculate weights for a block of events at each of the input dial points
    void        Print         (void);                             ///< print
 
   private:
@@ -58,6 +58,31 @@ namespace rew   {
   //! calculate penalty factors
   virtual double CalcChisq (void) = 0;        
 
+  //
+  // optional support for event-major multi-dial reweighting (see
+  // GReWeight::CalcWeights()): weight calculators may compute once per event
+  // all quantities that do not depend on the nuisance param values, store
+  // them in the given slot and re-use them for every set of param values
+  //
+
+  //! compute & store the param-independent quantities for the input event
+  virtual void CacheEvent (int /*islot*/, const genie::EventRecord & /*event*/) 
+  { 
+
+  }
+
+  //! calculate a weight for the event stored in the given slot
+  virtual double CalcWeightCached (int /*islot*/, const genie::EventRecord & event) 
+  { 
+    return this->CalcWeight(event); 
+  }
+
+  //! drop all stored event quantities
+  virtual void ClearEventCache (void) 
+  { 
+
+  }
+
  protected:
 
    GReWeightI() 
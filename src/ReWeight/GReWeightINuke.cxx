@@ -51,6 +51,8 @@
 #include "ReWeight/GSystUncertainty.h"
 #include "Utils/NuclearUtils.h"
 
+using std::vector;
+
 using namespace genie;
 using namespace genie::rew;
 
@@ -124,15 +126,52 @@ void GReWeightINuke::Reconfigure(void)
 //_______________________________________________________________________________________
 double GReWeightINuke::CalcWeight(const EventRecord & event) 
 {  
+  INukeEvent_t evt;
+  this->FindHadrons(event, evt);
+
+  return this->CalcWeight(evt);
+}
+//_______________________________________________________________________________________
+void GReWeightINuke::CacheEvent(int islot, const EventRecord & event)
+{
+  if(islot >= (int)fEventCache.size()) fEventCache.resize(islot+1);
+
+  this->FindHadrons(event, fEventCache[islot]);
+}
+//_______________________________________________________________________________________
+double GReWeightINuke::CalcWeightCached(int islot, const EventRecord & event)
+{
+  if(islot < 0 || islot >= (int)fEventCache.size()) {
+    return this->CalcWeight(event);
+  }
+  return this->CalcWeight(fEventCache[islot]);
+}
+//_______________________________________________________________________________________
+void GReWeightINuke::ClearEventCache(void)
+{
+  fEventCache.clear();
+}
+//_______________________________________________________________________________________
+void GReWeightINuke::FindHadrons(const EventRecord & event, INukeEvent_t & evt)
+{
+// Stores the hit nucleus and all hadrons rescattered by INTRANUKE, ie all
+// the event information needed for reweighting which does not depend on the
+// tweaking dial values
+
+  evt.A = 0;
+  evt.Z = 0;
+  evt.hadrons.clear();
+
   // get the atomic mass number for the hit nucleus
   GHepParticle * tgt = event.TargetNucleus();
-  if (!tgt) return 1.0;
+  if (!tgt) return;
   double A = tgt->A();
   double Z = tgt->Z();
-  if (A<=1) return 1.0;
-  if (Z<=1) return 1.0;
+  if (A<=1) return;
+  if (Z<=1) return;
 
-  double event_weight  = 1.0;
+  evt.A = A;
+  evt.Z = Z;
 
   // Loop over stdhep entries and only calculate weights for particles. 
   // All particles that are not hadrons generated inside the nucleus are given weights of 1.0
@@ -171,12 +210,39 @@ double GReWeightINuke::CalcWeight(const EventRecord & event)
        LOG("ReW", pFATAL) << event;
        exit(1);
      }
-     bool escaped    = (fsi_code == (int)kIHAFtNoInteraction);
-     bool interacted = !escaped;
+
+     INukeHadron_t hadron;
+     hadron.pos        = ip;
+     hadron.pdgc       = pdgc;
+     hadron.fsi_code   = fsi_code;
+     hadron.interacted = (fsi_code != (int)kIHAFtNoInteraction);
+     hadron.x4.SetXYZT (p->Vx(), p->Vy(), p->Vz(), 0.    );
+     hadron.p4.SetPxPyPzE(p->Px(), p->Py(), p->Pz(), p->E());
+     hadron.depth      = -2.; // computed only if needed
+
+     evt.hadrons.push_back(hadron);
+  }//particle loop
+}
+//_______________________________________________________________________________________
+double GReWeightINuke::CalcWeight(INukeEvent_t & evt)
+{
+  double A = evt.A;
+  double Z = evt.Z;
+
+  double event_weight  = 1.0;
+
+  vector<INukeHadron_t>::iterator hiter = evt.hadrons.begin();
+  for( ; hiter != evt.hadrons.end(); ++hiter) {
+
+     INukeHadron_t & hadron = *hiter;
+
+     int  pdgc       = hadron.pdgc;
+     int  fsi_code   = hadron.fsi_code;
+     bool interacted = hadron.interacted;
 
      // Get 4-momentum and 4-position
-     TLorentzVector x4 (p->Vx(), p->Vy(), p->Vz(), 0.    );
-     TLorentzVector p4 (p->Px(), p->Py(), p->Pz(), p->E());
+     const TLorentzVector & x4 = hadron.x4;
+     const TLorentzVector & p4 = hadron.p4;
 
      // Init current hadron weights
      double w_mfp  = 1.0;
@@ -191,7 +257,17 @@ double GReWeightINuke::CalcWeight(const EventRecord & event)
      if(calc_w_mfp)
      {
         mfp_scale_factor = fINukeRwParams.MeanFreePathParams(pdgc)->ScaleFactor();
-        w_mfp = utils::rew::MeanFreePathWeight(pdgc,x4,p4,A,Z,mfp_scale_factor,interacted);
+
+        // The optical depth along the hadron path does not depend on the
+        // mean free path scale: compute it once per hadron
+        if(hadron.depth < -1.) {
+           hadron.depth = utils::intranuke::OpticalDepth(pdgc,x4,p4,A,Z);
+        }
+        double pdef = utils::intranuke::ProbSurvival(hadron.depth,1.);
+        double ptwk = utils::intranuke::ProbSurvival(hadron.depth,mfp_scale_factor);
+        if(pdef > 0 && ptwk > 0) {
+           w_mfp = utils::rew::MeanFreePathWeight(pdef,ptwk,interacted);
+        }
      } // calculate mfp weight?
 
      // Compute weight to account for changes in relative fractions of reaction channels
@@ -207,7 +283,7 @@ double GReWeightINuke::CalcWeight(const EventRecord & event)
      double hadron_weight = w_mfp * w_fate;
 
      LOG("ReW", pNOTICE) 
-        << "Reweighted hadron at position = " << ip
+        << "Reweighted hadron at position = " << hadron.pos
         << " with PDG code = " << pdgc 
         << ", FSI code = "  << fsi_code 
         << " (" << INukeHadroFates::AsString((INukeFateHA_t)fsi_code) << ") :"
@@ -218,7 +294,7 @@ double GReWeightINuke::CalcWeight(const EventRecord & event)
 #ifdef _G_REWEIGHT_INUKE_DEBUG_NTP_
      double d        = utils::intranuke::Dist2Exit(x4,p4,A);
      double d_mfp    = utils::intranuke::Dist2ExitMFP(pdgc,x4,p4,A,Z);
-     double Eh       = p->E();
+     double Eh       = p4.E();
      double iflag    = (interacted) ? 1 : 0;
      fTestNtp->Fill(pdgc, Eh, mfp_scale_factor, d, d_mfp, fsi_code, iflag, w_mfp, w_fate);
 #endif
@@ -226,7 +302,7 @@ double GReWeightINuke::CalcWeight(const EventRecord & event)
      // Update the current event weight
      event_weight *= hadron_weight;
      
-  }//particle loop
+  }//hadron loop
   
   return event_weight;
 }
@@ -35,15 +35,20 @@
 
 //#define _G_REWEIGHT_INUKE_DEBUG_NTP_
 
+#include <vector>
+
+#include <TLorentzVector.h>
+
 #include "ReWeight/GReWeightI.h"
 #include "ReWeight/GReWeightINukeParams.h"
 
+using std::vector;
+
 using namespace genie::rew;
 using namespace genie;
 
 class TFile;
 class TNtuple;
-class TLorentzVector;
 
 namespace genie {
 namespace rew   {
@@ -62,9 +67,37 @@ namespace rew   {
    double CalcWeight     (const EventRecord & event);
    double CalcChisq      (void);
 
+   // event-major multi-dial reweighting: the rescattered hadrons and the
+   // optical depths along their paths are computed once per event
+   void   CacheEvent       (int islot, const EventRecord & event);
+   double CalcWeightCached (int islot, const EventRecord & event);
+   void   ClearEventCache  (void);
+
  private:
 
+   // hadron rescattered by INTRANUKE
+   typedef struct EINukeHadron {
+     int            pos;        ///< position in the event record
+     int            pdgc;       ///< PDG code
+     int            fsi_code;   ///< INTRANUKE/hA fate
+     bool           interacted; ///< re-interacted or escaped
+     TLorentzVector x4;         ///< 4-position in the nucleus coordinate system (fm)
+     TLorentzVector p4;         ///< 4-momentum (GeV)
+     double         depth;      ///< optical depth along its path (< -1 if not computed yet)
+   } INukeHadron_t;
+
+   // hit nucleus and rescattered hadrons of an event
+   typedef struct EINukeEvent {
+     double                A;
+     double                Z;
+     vector<INukeHadron_t> hadrons;
+   } INukeEvent_t;
+
+   void   FindHadrons    (const EventRecord & event, INukeEvent_t & evt);
+   double CalcWeight     (INukeEvent_t & evt);
+
    GReWeightINukeParams fINukeRwParams;
+   vector<INukeEvent_t> fEventCache;   ///< cached events, by slot
    TFile *              fTestFile;
    TNtuple *            fTestNtp;
  };
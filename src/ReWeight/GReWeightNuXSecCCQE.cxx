@@ -30,6 +30,8 @@
 */
 //____________________________________________________________________________
 
+#include <vector>
+
 #include <TMath.h>
 #include <TFile.h>
 #include <TNtupleD.h>
@@ -45,6 +47,7 @@
 #include "Messenger/Messenger.h"
 #include "PDG/PDGCodes.h"
 #include "ReWeight/GReWeightNuXSecCCQE.h"
+#include "ReWeight/GReWeightNuXSecIntCache.h"
 #include "ReWeight/GSystSet.h"
 #include "ReWeight/GSystUncertainty.h"
 #include "ReWeight/GReWeightUtils.h"
@@ -52,6 +55,8 @@
 
 //#define _G_REWEIGHT_CCQE_DEBUG_
 
+using std::vector;
+
 using namespace genie;
 using namespace genie::rew;
 
@@ -66,6 +71,8 @@ GReWeightNuXSecCCQE::GReWeightNuXSecCCQE()
 //_______________________________________________________________________________________
 GReWeightNuXSecCCQE::~GReWeightNuXSecCCQE()
 {
+  delete fXSecIntDef;
+  delete fXSecIntTwk;
 #ifdef _G_REWEIGHT_CCQE_DEBUG_
   fTestFile->cd();
   fTestNtp ->Write();
@@ -159,6 +166,11 @@ void GReWeightNuXSecCCQE::Reconfigure(void)
   r.Set(fMaPath, fMaCurr); 
   fXSecModel->Configure(r);
 
+  // use the tweaked model integrated cross sections for this configuration
+  vector<double> config;
+  config.push_back(fMaCurr);
+  fXSecIntTwk->SelectConfig(config);
+
 //LOG("ReW, pDEBUG) << *fXSecModel;
 }
 //_______________________________________________________________________________________
@@ -223,6 +235,9 @@ void GReWeightNuXSecCCQE::Init(void)
   fXSecModelConfig = new Registry(fXSecModel->GetConfig());
 //LOG("ReW, pDEBUG) << *fXSecModelConfig;
 
+  fXSecIntDef = new GReWeightNuXSecIntCache(fXSecModelDef);
+  fXSecIntTwk = new GReWeightNuXSecIntCache(fXSecModel);
+
   this->SetMode(kModeNormAndMaShape);
 
   this->RewNue    (true);
@@ -301,8 +316,8 @@ double GReWeightNuXSecCCQE::CalcWeightMaShape(const genie::EventRecord & event)
 //LOG("ReW", pDEBUG) << "new weight = " << new_weight;
 
 //double old_integrated_xsec = event.XSec();
-  double old_integrated_xsec = fXSecModelDef -> Integral(interaction);
-  double new_integrated_xsec = fXSecModel    -> Integral(interaction);   
+  double old_integrated_xsec = fXSecIntDef -> Integral(interaction);
+  double new_integrated_xsec = fXSecIntTwk -> Integral(interaction);   
   assert(new_integrated_xsec > 0);
   new_weight *= (old_integrated_xsec/new_integrated_xsec);
 
@@ -40,6 +40,8 @@ class Registry;
 
 namespace rew   {
 
+ class GReWeightNuXSecIntCache;
+
  class GReWeightNuXSecCCQE : public GReWeightI 
  {
  public:
@@ -75,6 +77,8 @@ namespace rew   {
    XSecAlgorithmI * fXSecModelDef;    ///< default model
    XSecAlgorithmI * fXSecModel;       ///< tweaked model
    Registry *       fXSecModelConfig; ///< config in tweaked model
+   GReWeightNuXSecIntCache * fXSecIntDef; ///< integrated cross sections for the default model
+   GReWeightNuXSecIntCache * fXSecIntTwk; ///< integrated cross sections for the tweaked model
 
    int    fMode;         ///< 0: Ma, 1: Norm and MaShape
    bool   fRewNue;       ///< reweight nu_e CC?
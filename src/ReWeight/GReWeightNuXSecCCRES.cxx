@@ -26,6 +26,7 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <vector>
 
 #include <TMath.h>
 #include <TFile.h>
@@ -42,12 +43,15 @@
 #include "Messenger/Messenger.h"
 #include "PDG/PDGCodes.h"
 #include "ReWeight/GReWeightNuXSecCCRES.h"
+#include "ReWeight/GReWeightNuXSecIntCache.h"
 #include "ReWeight/GSystSet.h"
 #include "ReWeight/GSystUncertainty.h"
 #include "Registry/Registry.h"
 
 //#define _G_REWEIGHT_CCRES_DEBUG_
 
+using std::vector;
+
 using namespace genie;
 using namespace genie::rew;
 
@@ -62,6 +66,8 @@ GReWeightNuXSecCCRES::GReWeightNuXSecCCRES()
 //_______________________________________________________________________________________
 GReWeightNuXSecCCRES::~GReWeightNuXSecCCRES()
 {
+  delete fXSecIntDef;
+  delete fXSecIntTwk;
 #ifdef _G_REWEIGHT_CCRES_DEBUG_
   fTestFile->cd();
   fTestNtp ->Write();
@@ -166,6 +172,12 @@ void GReWeightNuXSecCCRES::Reconfigure(void)
   r.Set(fMvPath, fMvCurr); 
   fXSecModel->Configure(r);
 
+  // use the tweaked model integrated cross sections for this configuration
+  vector<double> config;
+  config.push_back(fMaCurr);
+  config.push_back(fMvCurr);
+  fXSecIntTwk->SelectConfig(config);
+
 //LOG("ReW, pDEBUG) << *fXSecModel;
 }
 //_______________________________________________________________________________________
@@ -229,6 +241,9 @@ void GReWeightNuXSecCCRES::Init(void)
   fXSecModelConfig = new Registry(fXSecModel->GetConfig());
 //LOG("ReW", pNOTICE) << *fXSecModelConfig;
 
+  fXSecIntDef = new GReWeightNuXSecIntCache(fXSecModelDef);
+  fXSecIntTwk = new GReWeightNuXSecIntCache(fXSecModel);
+
   this->SetMode(kModeNormAndMaMvShape);
 
   this->RewNue    (true);
@@ -307,8 +322,8 @@ double GReWeightNuXSecCCRES::CalcWeightMaMvShape(const genie::EventRecord & even
 //LOG("ReW", pDEBUG) << "new weight = " << new_weight;
 
 //double old_integrated_xsec = event.XSec();
-  double old_integrated_xsec = fXSecModelDef -> Integral(interaction);
-  double twk_integrated_xsec = fXSecModel    -> Integral(interaction);
+  double old_integrated_xsec = fXSecIntDef -> Integral(interaction);
+  double twk_integrated_xsec = fXSecIntTwk -> Integral(interaction);
   assert(twk_integrated_xsec > 0);
   new_weight *= (old_integrated_xsec/twk_integrated_xsec);
 
@@ -40,6 +40,8 @@ class Registry;
 
 namespace rew   {
 
+ class GReWeightNuXSecIntCache;
+
  class GReWeightNuXSecCCRES : public GReWeightI 
  {
  public:
@@ -76,6 +78,8 @@ namespace rew   {
    XSecAlgorithmI * fXSecModelDef;    ///< default model
    XSecAlgorithmI * fXSecModel;       ///< tweaked model
    Registry *       fXSecModelConfig; ///< config in tweaked model
+   GReWeightNuXSecIntCache * fXSecIntDef; ///< integrated cross sections for the default model
+   GReWeightNuXSecIntCache * fXSecIntTwk; ///< integrated cross sections for the tweaked model
 
    int    fMode;         ///< 0: Ma/Mv, 1: Norm and MaShape/MvShape
    string fMaPath;       ///< M_{A} path in configuration
@@ -0,0 +1,172 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+         Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+         STFC, Rutherford Appleton Laboratory
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include <vector>
+
+#include <TLorentzVector.h>
+#include <TMath.h>
+
+#include "Base/XSecAlgorithmI.h"
+#include "Conventions/RefFrame.h"
+#include "Interaction/Interaction.h"
+#include "Messenger/Messenger.h"
+#include "Numerical/Spline.h"
+#include "ReWeight/GReWeightNuXSecIntCache.h"
+
+using std::vector;
+
+using namespace genie;
+using namespace genie::rew;
+
+const unsigned int GReWeightNuXSecIntCache::kMaxNConfigs;
+
+//___________________________________________________________________________
+GReWeightNuXSecIntCache::GReWeightNuXSecIntCache(
+         const XSecAlgorithmI * model, int nknots, double Emin, double Emax) :
+fModel  (model),
+fNKnots (0),
+fEmin   (0.),
+fEmax   (0.),
+fCurrSplines(0)
+{
+  fCurrSplines = &fSplines[fCurrConfig];
+
+  this->SetNKnots(nknots);
+  this->SetEnergyRange(Emin, Emax);
+}
+//___________________________________________________________________________
+GReWeightNuXSecIntCache::~GReWeightNuXSecIntCache()
+{
+  this->Reset();
+}
+//___________________________________________________________________________
+void GReWeightNuXSecIntCache::SetModel(const XSecAlgorithmI * model)
+{
+  fModel = model;
+  this->Reset();
+}
+//___________________________________________________________________________
+void GReWeightNuXSecIntCache::SetNKnots(int nknots)
+{
+  fNKnots = TMath::Max(10, nknots);
+  this->Reset();
+}
+//___________________________________________________________________________
+void GReWeightNuXSecIntCache::SetEnergyRange(double Emin, double Emax)
+{
+  if(Emin <= 0 || Emax <= Emin) {
+    LOG("ReW", pERROR)
+      << "Invalid energy range: [" << Emin << ", " << Emax << "] GeV";
+    return;
+  }
+  fEmin = Emin;
+  fEmax = Emax;
+  this->Reset();
+}
+//___________________________________________________________________________
+double GReWeightNuXSecIntCache::Integral(const Interaction * interaction)
+{
+  if(!fModel) return 0.;
+
+  const Spline * spline = 0;
+  SplineMap_t::const_iterator it = fCurrSplines->find(interaction->Code());
+  if(it != fCurrSplines->end()) spline = it->second;
+  else spline = this->BuildSpline(interaction);
+
+  if(spline) {
+    double E = interaction->InitState().ProbeE(kRfHitNucRest);
+    if(E >= spline->XMin() && E <= spline->XMax()) {
+       double xsec = spline->Evaluate(E);
+       if(xsec > 0) return xsec;
+    }
+  }
+
+  // no spline, or outside its range: compute it
+  return fModel->Integral(interaction);
+}
+//___________________________________________________________________________
+void GReWeightNuXSecIntCache::SelectConfig(const vector<double> & params)
+{
+  fCurrConfig = params;
+
+  map<vector<double>, SplineMap_t>::iterator it = fSplines.find(params);
+  if(it != fSplines.end()) {
+    fCurrSplines = &(it->second);
+    return;
+  }
+
+  if(fSplines.size() >= kMaxNConfigs) {
+    LOG("ReW", pNOTICE)
+      << "Cached integrated cross sections for " << fSplines.size()
+      << " model configurations - Dropping them all";
+    this->Reset();
+  }
+  fCurrSplines = &fSplines[fCurrConfig];
+}
+//___________________________________________________________________________
+void GReWeightNuXSecIntCache::Reset(void)
+{
+  map<vector<double>, SplineMap_t>::iterator cit = fSplines.begin();
+  for( ; cit != fSplines.end(); ++cit) {
+    SplineMap_t::iterator it = cit->second.begin();
+    for( ; it != cit->second.end(); ++it) {
+      if(it->second) delete it->second;
+    }
+  }
+  fSplines.clear();
+  fCurrSplines = &fSplines[fCurrConfig];
+}
+//___________________________________________________________________________
+const Spline * GReWeightNuXSecIntCache::BuildSpline(
+                                         const Interaction * interaction)
+{
+  Interaction in(*interaction);
+
+  // energies are given in the hit nucleon rest frame
+  Target * tgt = in.InitStatePtr()->TgtPtr();
+  if(tgt->HitNucIsSet()) {
+    TLorentzVector p4nuc(0, 0, 0, tgt->HitNucMass());
+    tgt->SetHitNucP4(p4nuc);
+  }
+
+  Spline * spline = 0;
+
+  double Ethr = in.PhaseSpace().Threshold();
+  double E0   = TMath::Max(Ethr, fEmin);
+
+  if(E0 < fEmax) {
+    LOG("ReW", pNOTICE)
+      << "Caching integrated cross sections for: " << in.AsString();
+
+    // knots log-spaced in [max(Ethr,Emin), Emax]
+    vector<double> E   (fNKnots);
+    vector<double> xsec(fNKnots);
+    double dlogE = TMath::Log(fEmax/E0) / (fNKnots-1);
+    for(int i = 0; i < fNKnots; i++) {
+      E[i] = (i == fNKnots-1) ? fEmax : E0 * TMath::Exp(i*dlogE);
+      TLorentzVector p4(0, 0, E[i], E[i]);
+      in.InitStatePtr()->SetProbeP4(p4);
+      xsec[i] = fModel->Integral(&in);
+    }
+    spline = new Spline(fNKnots, &E[0], &xsec[0]);
+  }
+
+  fCurrSplines->insert(SplineMap_t::value_type(interaction->Code(), spline));
+
+  return spline;
+}
+//___________________________________________________________________________
@@ -0,0 +1,101 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::rew::GReWeightNuXSecIntCache
+
+\brief   Cache of integrated cross sections used by the cross section model
+         reweighting engines that normalize the tweaked differential cross
+         section to a constant integral (`shape-only' reweighting).
+
+         For each interaction met (as identified by Interaction::Code()),
+         the integrated cross section of the input model is computed at a
+         number of energies and stored in a spline in the probe energy at
+         the hit nucleon rest frame. Later events for the same interaction
+         evaluate that spline instead of running the numerical integration.
+         Events outside the spline energy range (or where the spline does
+         not give a positive value) fall back to XSecAlgorithmI::Integral().
+
+         Splines are kept separately for each model configuration, as
+         identified by the values of the tweaked model parameters passed to
+         SelectConfig() at each GReWeightI::Reconfigure(). Returning to a
+         configuration already met (eg when an event-major multi-dial scan
+         processes its input in blocks) re-uses its splines. Splines for at
+         most kMaxNConfigs configurations are kept: when that number is
+         exceeded all splines are dropped. Reset() drops all splines.
+
+\author  The GENIE Collaboration
+         Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+         STFC, Rutherford Appleton Laboratory
+
+\created October 16, 2026
+
+\cpright Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _G_REWEIGHT_NEUTRINO_XSEC_INTEGRAL_CACHE_H_
+#define _G_REWEIGHT_NEUTRINO_XSEC_INTEGRAL_CACHE_H_
+
+#include <map>
+#include <vector>
+
+#include <Rtypes.h>
+
+using std::map;
+using std::vector;
+
+namespace genie {
+
+class XSecAlgorithmI;
+class Interaction;
+class Spline;
+
+namespace rew {
+
+class GReWeightNuXSecIntCache {
+
+public :
+  GReWeightNuXSecIntCache(const XSecAlgorithmI * model = 0,
+                          int nknots = 100, double Emin = 0.01, double Emax = 100.);
+ ~GReWeightNuXSecIntCache();
+
+  void   SetModel     (const XSecAlgorithmI * model);
+  void   SetNKnots    (int nknots);
+  void   SetEnergyRange (double Emin, double Emax);
+
+  //! Integrated cross section for the input interaction (spline based)
+  double Integral     (const Interaction * interaction);
+
+  //! Use the splines of the input model configuration (the values of all
+  //! tweaked model parameters; to be called once the model is reconfigured)
+  void   SelectConfig (const vector<double> & params);
+
+  //! Drop all splines
+  void   Reset        (void);
+
+  int    NSplines     (void) const { return fCurrSplines->size(); }
+  int    NConfigs     (void) const { return fSplines.size(); }
+
+  static const unsigned int kMaxNConfigs = 100;
+
+private:
+
+  typedef map<ULong64_t, Spline *> SplineMap_t;
+
+  const Spline * BuildSpline (const Interaction * interaction);
+
+  const XSecAlgorithmI *   fModel;   ///< cross section model
+  int                      fNKnots;  ///< number of knots per spline
+  double                   fEmin;    ///< min energy of splines (GeV)
+  double                   fEmax;    ///< max energy of splines (GeV)
+  map<vector<double>, SplineMap_t> fSplines;     ///< model config -> (Interaction::Code() -> integrated xsec spline (0 if not built))
+  vector<double>                   fCurrConfig;  ///< current model config
+  SplineMap_t *                    fCurrSplines; ///< splines for the current model config
+};
+
+}      // rew   namespace
+}      // genie namespace
+
+#endif // _G_REWEIGHT_NEUTRINO_XSEC_INTEGRAL_CACHE_H_
@@ -24,6 +24,7 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <vector>
 
 #include <TMath.h>
 
@@ -38,10 +39,13 @@
 #include "Messenger/Messenger.h"
 #include "PDG/PDGCodes.h"
 #include "ReWeight/GReWeightNuXSecNCRES.h"
+#include "ReWeight/GReWeightNuXSecIntCache.h"
 #include "ReWeight/GSystSet.h"
 #include "ReWeight/GSystUncertainty.h"
 #include "Registry/Registry.h"
 
+using std::vector;
+
 using namespace genie;
 using namespace genie::rew;
 
@@ -56,7 +60,8 @@ GReWeightNuXSecNCRES::GReWeightNuXSecNCRES()
 //_______________________________________________________________________________________
 GReWeightNuXSecNCRES::~GReWeightNuXSecNCRES()
 {
-
+  delete fXSecIntDef;
+  delete fXSecIntTwk;
 }
 //_______________________________________________________________________________________
 bool GReWeightNuXSecNCRES::IsHandled(GSyst_t syst)
@@ -155,6 +160,12 @@ void GReWeightNuXSecNCRES::Reconfigure(void)
   r.Set(fMvPath, fMvCurr); 
   fXSecModel->Configure(r);
 
+  // use the tweaked model integrated cross sections for this configuration
+  vector<double> config;
+  config.push_back(fMaCurr);
+  config.push_back(fMvCurr);
+  fXSecIntTwk->SelectConfig(config);
+
 //LOG("ReW, pDEBUG) << *fXSecModel;
 }
 //_______________________________________________________________________________________
@@ -218,6 +229,9 @@ void GReWeightNuXSecNCRES::Init(void)
   fXSecModelConfig = new Registry(fXSecModel->GetConfig());
 //LOG("ReW", pNOTICE) << *fXSecModelConfig;
 
+  fXSecIntDef = new GReWeightNuXSecIntCache(fXSecModelDef);
+  fXSecIntTwk = new GReWeightNuXSecIntCache(fXSecModel);
+
   this->SetMode(kModeNormAndMaMvShape);
 
   this->RewNue    (true);
@@ -291,8 +305,8 @@ double GReWeightNuXSecNCRES::CalcWeightMaMvShape(const genie::EventRecord & even
 //LOG("ReW", pDEBUG) << "new weight = " << new_weight;
 
 //double old_integrated_xsec = event.XSec();
-  double old_integrated_xsec = fXSecModelDef -> Integral(interaction);
-  double twk_integrated_xsec = fXSecModel    -> Integral(interaction);   
+  double old_integrated_xsec = fXSecIntDef -> Integral(interaction);
+  double twk_integrated_xsec = fXSecIntTwk -> Integral(interaction);   
   assert(twk_integrated_xsec > 0);
   new_weight *= (old_integrated_xsec/twk_integrated_xsec);
 
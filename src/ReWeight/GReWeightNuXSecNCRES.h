@@ -38,6 +38,8 @@ class Registry;
 
 namespace rew   {
 
+ class GReWeightNuXSecIntCache;
+
  class GReWeightNuXSecNCRES : public GReWeightI 
  {
  public:
@@ -74,6 +76,8 @@ namespace rew   {
    XSecAlgorithmI * fXSecModelDef;    ///< default model
    XSecAlgorithmI * fXSecModel;       ///< tweaked model
    Registry *       fXSecModelConfig; ///< config in tweaked model
+   GReWeightNuXSecIntCache * fXSecIntDef; ///< integrated cross sections for the default model
+   GReWeightNuXSecIntCache * fXSecIntTwk; ///< integrated cross sections for the tweaked model
 
    int    fMode;         ///< 0: Ma/Mv, 1: Norm and MaShape/MvShape
    string fMaPath;       ///< M_{A} path in configuration
@@ -60,15 +60,18 @@ double genie::utils::rew::MeanFreePathWeight(
      << "nR_pion = " << nRpi << ", nR_nucleon = " << nRnuc 
      << ", NR = " << NR << ", R0 = " << R0;
 
+   // The optical depth along the hadron path is the same for the nominal
+   // and the tweaked mean free path: compute it once
+   double depth = utils::intranuke::OpticalDepth(
+      pdgc,x4,p4,A,Z,nRpi,nRnuc,NR,R0);
+
    // Get the nominal survival probability
-   double pdef = utils::intranuke::ProbSurvival(
-      pdgc,x4,p4,A,Z,1.,nRpi,nRnuc,NR,R0);
+   double pdef = utils::intranuke::ProbSurvival(depth,1.);
    LOG("ReW", pINFO)  << "Probability(default mfp) = " << pdef;      
    if(pdef<=0) return 1.;
 
    // Get the survival probability for the tweaked mean free path
-   double ptwk = utils::intranuke::ProbSurvival(
-      pdgc,x4,p4,A,Z,mfp_scale_factor,nRpi,nRnuc,NR,R0);
+   double ptwk = utils::intranuke::ProbSurvival(depth,mfp_scale_factor);
    LOG("ReW", pINFO)  << "Probability(tweaked mfp) = " << ptwk;      
    if(ptwk<=0) return 1.;
 
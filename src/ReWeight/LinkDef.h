@@ -33,5 +33,6 @@
 #pragma link C++ class genie::rew::GReWeightNuXSecDIS;
 #pragma link C++ class genie::rew::GReWeightNuXSecNC;
 #pragma link C++ class genie::rew::GReWeightNuXSecHelper;
+#pragma link C++ class genie::rew::GReWeightNuXSecIntCache;
 
 #endif
@@ -19,8 +19,10 @@
 
 #include <sstream>
 #include <iostream>
+#include <vector>
 
 #include <TSystem.h>
+#include <TROOT.h>
 #include <TDirectory.h>
 #include <TList.h>
 #include <TObjString.h>
@@ -31,6 +33,7 @@
 
 using std::ostringstream;
 using std::endl;
+using std::vector;
 
 namespace genie {
 
@@ -45,9 +48,10 @@ Cache * Cache::fInstance = 0;
 //____________________________________________________________________________
 Cache::Cache()
 {
-  fInstance  = 0;
-  fCacheMap  = 0;
-  fCacheFile = 0;
+  fInstance     = 0;
+  fCacheMap     = 0;
+  fCacheFile    = 0;
+  fCacheFilePid = 0;
 }
 //____________________________________________________________________________
 Cache::~Cache()
@@ -67,7 +71,13 @@ Cache::~Cache()
     delete fCacheMap;
   }
   if(fCacheFile) {
-    fCacheFile->Close();
+    // forked processes must not close the writable file they inherited:
+    // that would rewrite its header, free segments and keys
+    if(gSystem->GetPid() == fCacheFilePid) {
+      fCacheFile->Close();
+    } else {
+      fCacheFile->SetWritable(kFALSE);
+    }
     delete fCacheFile;
   }
   fInstance = 0;
@@ -90,8 +100,20 @@ CacheBranchI * Cache::FindCacheBranch(string key)
 {
   map<string, CacheBranchI *>::const_iterator map_iter = fCacheMap->find(key);
 
-  if (map_iter == fCacheMap->end()) return 0;
-  return map_iter->second;
+  if (map_iter != fCacheMap->end()) return map_iter->second;
+
+  // not used yet by the current job: look it up in the cache file index
+  if(!fCacheFile) return 0;
+  map<string, int>::const_iterator idx_iter = fCacheIndex.find(key);
+  if(idx_iter == fCacheIndex.end()) return 0;
+
+  string bname = this->BufferName(idx_iter->second);
+  CacheBranchI * branch = (CacheBranchI*) fCacheFile->Get(bname.c_str());
+  if(branch) {
+    LOG("Cache", pINFO) << "Loaded cache branch: " << key;
+    fCacheMap->insert( map<string, CacheBranchI *>::value_type(key,branch) );
+  }
+  return branch;
 }
 //____________________________________________________________________________
 void Cache::AddCacheBranch(string key, CacheBranchI * branch)
@@ -131,6 +153,7 @@ void Cache::RmAllCacheBranches(void)
     }
     fCacheMap->clear();
   }
+  fCacheIndex.clear();
 }
 //____________________________________________________________________________
 void Cache::RmMatchedCacheBranches(string key_substring)
@@ -141,54 +164,84 @@ void Cache::RmMatchedCacheBranches(string key_substring)
 //____________________________________________________________________________
 void Cache::Load(void)
 {
+// Reads the index of the cache branches stored at the cache file.
+// The i^th key of the index corresponds to the buffer_i object.
+// The cache branches themselves are read on demand (see FindCacheBranch()).
+
   LOG("Cache", pNOTICE) << "Loading cache";
 
+  fCacheIndex.clear();
+
   if(!fCacheFile) return;
   TList * keys = (TList*) fCacheFile->Get("key_list");
+  if(!keys) return;
+
   TIter kiter(keys);
   TObjString * keyobj = 0;
   int ib=0;
   while ((keyobj = (TObjString *)kiter.Next())) {
     string key = string(keyobj->GetString().Data());
-    ostringstream bname;
-    bname << "buffer_" << ib++;
-    CacheBranchI * buffer = (CacheBranchI*) fCacheFile->Get(bname.str().c_str());
-    if(buffer) {
-     fCacheMap->insert( map<string, CacheBranchI *>::value_type(key,buffer) );
-    }
+    fCacheIndex.insert( map<string, int>::value_type(key,ib++) );
   }
-  LOG("Cache", pNOTICE) << "Cache loaded...";
-  LOG("Cache", pNOTICE) << *this;
+  keys->SetOwner(true);
+  delete keys;
+
+  LOG("Cache", pNOTICE) 
+     << "Cache loaded: " << fCacheIndex.size() << " cache branches available";
 }
 //____________________________________________________________________________
 void Cache::Save(void)
 {
+// Writes out the cache branches used by the current job (the ones that were
+// never looked up are already in the file) and the updated cache index.
+
   if(!fCacheFile) {
     return;
   }
+  // forked processes (eg event generation workers) do not own the file
+  if(gSystem->GetPid() != fCacheFilePid) {
+    return;
+  }
   fCacheFile->cd();
 
-  int ib=0;
-  TList * keys = new TList;
-  keys->SetOwner(true);
-
   map<string, CacheBranchI * >::iterator citer;
   for(citer = fCacheMap->begin(); citer != fCacheMap->end(); ++citer) {
     string key = citer->first;
     CacheBranchI * branch = citer->second;
-    if(branch) {
-      ostringstream bname;
-      bname << "buffer_" << ib++;
-      keys->Add(new TObjString(key.c_str()));
-      branch->Write(bname.str().c_str(), TObject::kOverwrite);
+    if(!branch) continue;
+    // new cache branches are appended to the index
+    if(fCacheIndex.find(key) == fCacheIndex.end()) {
+      int ib = fCacheIndex.size();
+      fCacheIndex.insert( map<string, int>::value_type(key,ib) );
     }
+    string bname = this->BufferName(fCacheIndex[key]);
+    branch->Write(bname.c_str(), TObject::kOverwrite);
   }
-  keys->Write("key_list", TObject::kSingleKey&&TObject::kOverwrite);
+
+  vector<string> keyvec(fCacheIndex.size());
+  map<string, int>::const_iterator idx_iter = fCacheIndex.begin();
+  for( ; idx_iter != fCacheIndex.end(); ++idx_iter) {
+    keyvec[idx_iter->second] = idx_iter->first;
+  }
+
+  TList * keys = new TList;
+  keys->SetOwner(true);
+  for(unsigned int ib = 0; ib < keyvec.size(); ib++) {
+    keys->Add(new TObjString(keyvec[ib].c_str()));
+  }
+  keys->Write("key_list", TObject::kSingleKey|TObject::kOverwrite);
 
   keys->Clear();
   delete keys;
 }
 //____________________________________________________________________________
+string Cache::BufferName(int ibuffer) const
+{
+  ostringstream bname;
+  bname << "buffer_" << ibuffer;
+  return bname.str();
+}
+//____________________________________________________________________________
 void Cache::OpenCacheFile(string filename)
 {
   if(filename.size() == 0) return;
@@ -208,10 +261,43 @@ void Cache::OpenCacheFile(string filename)
      fCacheFile = 0;
      LOG("Cache", pWARN) << "Could not open cache file: " << filename;
   }
+  fCacheFilePid = gSystem->GetPid();
 
   this->Load();
 }
 //____________________________________________________________________________
+void Cache::DetachCacheFile(void)
+{
+// To be called in processes forked after the cache file was opened (eg event
+// generation workers, see GMCJWorkerPool). The inherited file shares its 
+// descriptor and offset with the process that opened it, so it is released
+// without being written and the cache file is reopened read-only, for the 
+// cache branches read on demand by this process (see FindCacheBranch()).
+// Cache branches are never saved by such processes (see Save()).
+
+  if(!fCacheFile) return;
+  if(gSystem->GetPid() == fCacheFilePid) return;
+
+  string filename = fCacheFile->GetName();
+
+  TDirectory * curr_dir = (gDirectory == fCacheFile) ? gROOT : gDirectory;
+
+  fCacheFile->SetWritable(kFALSE);
+  delete fCacheFile;
+
+  fCacheFile = new TFile(filename.c_str(),"read");
+  if(!fCacheFile->IsOpen()) {
+     delete fCacheFile;
+     fCacheFile = 0;
+     LOG("Cache", pWARN) << "Could not reopen cache file: " << filename;
+  }
+  curr_dir->cd();
+
+  LOG("Cache", pINFO) 
+     << "Cache file: " << filename << " reopened read-only in process "
+     << gSystem->GetPid();
+}
+//____________________________________________________________________________
 void Cache::Print(ostream & stream) const
 {
   stream << "\n [-] GENIE Cache Buffers:";
@@ -5,6 +5,12 @@
 
 \brief    GENIE Cache Memory
 
+          The cache can be saved in a ROOT file (see OpenCacheFile()) and
+          re-used by later jobs. The file holds one object per cache branch
+          plus an index of the cache branch keys. Only the index is read
+          when the file is opened: Each cache branch is read from the file
+          the first time it is looked up.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           STFC, Rutherford Appleton Laboratory
 
@@ -40,7 +46,8 @@ public:
   static Cache * Instance(void);
 
   //! cache file
-  void OpenCacheFile (string filename);
+  void OpenCacheFile   (string filename);
+  void DetachCacheFile (void);
 
   //! finding/adding cache branches
   CacheBranchI * FindCacheBranch (string key);
@@ -59,8 +66,9 @@ public:
 private:
 
   //! load/save
-  void Load (void);
-  void Save (void);
+  void   Load       (void);
+  void   Save       (void);
+  string BufferName (int ibuffer) const;
 
   //! singleton instance
   static Cache * fInstance;
@@ -68,6 +76,11 @@ private:
   //! map of cache buffers & cache file
   map<string, CacheBranchI * > * fCacheMap;
   TFile *                        fCacheFile;
+  int                            fCacheFilePid; ///< process that opened the cache file
+
+  //! index of cache branches found in (or to be saved at) the cache file:
+  //! cache branch key -> buffer number
+  map<string, int>               fCacheIndex;
 
   //! singleton class: constructors are private
   Cache();
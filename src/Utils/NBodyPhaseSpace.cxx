@@ -0,0 +1,190 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+         Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+         STFC, Rutherford Appleton Laboratory
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include <sstream>
+#include <iomanip>
+
+#include <TMath.h>
+#include <TRandom3.h>
+#include <TString.h>
+
+#include "Conventions/Controls.h"
+#include "Messenger/Messenger.h"
+#include "Utils/Cache.h"
+#include "Utils/CacheBranchFx.h"
+#include "Utils/NBodyPhaseSpace.h"
+
+using std::ostringstream;
+using std::setprecision;
+
+using namespace genie;
+using namespace genie::controls;
+
+// Max weight table binning in log(Q): ~5% bins, starting at 1 keV
+static const double kQBinMin   = 1E-6;
+static const double kDLogQBin  = 0.05;
+
+// TGenPhaseSpace weights are normalized by the product of the max momenta
+// of the successive 2-body decays (TGenPhaseSpace::GetWtMax()): They never
+// exceed 1
+static const double kPhaseSpaceWeightBound = 1.;
+
+//____________________________________________________________________________
+NBodyPhaseSpace::NBodyPhaseSpace() :
+fNDecay(0),
+fMassKey(""),
+fQ(0)
+{
+
+}
+//____________________________________________________________________________
+NBodyPhaseSpace::~NBodyPhaseSpace()
+{
+
+}
+//____________________________________________________________________________
+bool NBodyPhaseSpace::SetDecay(TLorentzVector & p4, int n, const double * mass)
+{
+  fNDecay  = 0;
+  fMass.clear();
+  fMassKey = "";
+  fQ       = 0;
+
+  bool permitted = fGenerator.SetDecay(p4, n, mass);
+  if(!permitted) return false;
+
+  ostringstream key;
+  key << setprecision(6);
+  double sum = 0;
+  for(int i = 0; i < n; i++) {
+    key << ((i==0) ? "" : ",") << mass[i];
+    sum += mass[i];
+  }
+  fNDecay  = n;
+  fMass.assign(mass, mass+n);
+  fMassKey = key.str();
+  fQ       = p4.M() - sum;
+
+  return true;
+}
+//____________________________________________________________________________
+double NBodyPhaseSpace::Generate(void)
+{
+  return fGenerator.Generate();
+}
+//____________________________________________________________________________
+bool NBodyPhaseSpace::GenerateUnweighted(TRandom & rnd, double safety_factor)
+{
+  // 2-body decays: all decays have the same weight
+  if(fNDecay == 2) {
+    fGenerator.Generate();
+    return true;
+  }
+
+  double wmax = safety_factor * this->MaxWeight();
+  if(wmax <= 0) return false;
+
+  for(unsigned int itry = 1; itry <= kMaxUnweightDecayIterations; itry++) {
+    double w  = fGenerator.Generate();
+    if(w > wmax) {
+       LOG("PhaseSpace", pWARN) 
+         << "Decay weight = " << w << " > max decay weight = " << wmax;
+    }
+    double gw = wmax * rnd.Rndm();
+    if(gw <= w) return true;
+  }
+
+  LOG("PhaseSpace", pWARN) 
+     << "Couldn't generate an unweighted phase space decay after " 
+     << kMaxUnweightDecayIterations << " attempts";
+  return false;
+}
+//____________________________________________________________________________
+double NBodyPhaseSpace::MaxWeight(void)
+{
+  if(fNDecay < 2) return 0;
+
+  // 2-body decays: all decays have the same weight, which is the bound 
+  // TGenPhaseSpace normalizes its weights to (see TGenPhaseSpace::GetWtMax())
+  if(fNDecay == 2) return kPhaseSpaceWeightBound;
+
+  double Qbin = this->QBin();
+
+  CacheBranchFx * table = this->MaxWeightTable();
+  const map<double,double> & wmap = table->Map();
+  map<double,double>::const_iterator iter = wmap.find(Qbin);
+  if(iter != wmap.end()) return iter->second;
+
+  // not tabulated yet: estimate from a number of weighted decays of a system
+  // at rest with Q at the upper edge of the bin (the largest weights in the
+  // bin). The decays are generated with a private generator & a random number
+  // sequence seeded from the table key, so that neither the current decay nor
+  // the random number sequences used in event generation are affected.
+  // The table is never updated from the decays generated for events, so that
+  // these do not depend on the decays generated earlier by the same process.
+  double wmax = -1;
+  double sum  = 0;
+  for(int i=0; i<fNDecay; i++) sum += fMass[i];
+  TLorentzVector p4(0, 0, 0, sum + Qbin);
+  TGenPhaseSpace generator;
+  if(generator.SetDecay(p4, fNDecay, &fMass[0])) {
+    ostringstream seed;
+    seed << fMassKey << ";" << Qbin;
+    TRandom3 rnd(TString(seed.str().c_str()).Hash() | 1);
+    TRandom * grnd = gRandom;
+    gRandom = &rnd;
+    for(int i=0; i<kNMaxWeightDecays; i++) {
+       double w = generator.Generate();   
+       wmax = TMath::Max(wmax,w);
+    }
+    gRandom = grnd;
+  }
+  // TGenPhaseSpace weights never exceed kPhaseSpaceWeightBound
+  if(wmax <= 0 || wmax > kPhaseSpaceWeightBound) wmax = kPhaseSpaceWeightBound;
+  table->AddValues(Qbin, wmax);
+
+  LOG("PhaseSpace", pINFO) 
+     << "Max phase space gen. weight for masses {" << fMassKey 
+     << "} at Q = " << Qbin << " GeV : " << wmax;
+
+  return wmax;
+}
+//____________________________________________________________________________
+double NBodyPhaseSpace::QBin(void) const
+{
+// Q bin of the current decay, identified by its upper edge
+//
+  int ibin = (int) TMath::Floor(
+                  TMath::Log(TMath::Max(fQ,kQBinMin)/kQBinMin) / kDLogQBin);
+  return kQBinMin * TMath::Exp((ibin+1) * kDLogQBin);
+}
+//____________________________________________________________________________
+CacheBranchFx * NBodyPhaseSpace::MaxWeightTable(void)
+{
+  Cache * cache = Cache::Instance();
+
+  string key = cache->CacheBranchKey("genie::NBodyPhaseSpace", fMassKey);
+
+  CacheBranchFx * table =
+              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+  if(!table) {
+    table = new CacheBranchFx("max phase space weight vs Q");
+    cache->AddCacheBranch(key, table);
+  }
+  return table;
+}
+//____________________________________________________________________________
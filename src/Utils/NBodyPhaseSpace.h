@@ -0,0 +1,97 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NBodyPhaseSpace
+
+\brief    N-body phase space decay generator shared by the hadronization,
+          MEC, nucleon decay and resonance decay modules.
+          It wraps ROOT's TGenPhaseSpace and keeps the maximum decay weight
+          (needed for generating unweighted decays with the rejection
+          method) in a table shared by all instances. The table is keyed by
+          the list of decay product masses and by the available kinetic
+          energy Q = M - sum(m_i) of the decaying system, in bins of fixed
+          logarithmic width. The max weight is estimated only the first
+          time a (mass list, Q bin) is encountered, rather than for every
+          decay. Since the weight grows with Q, it is estimated at the upper
+          edge of the Q bin (with a private random number sequence, so that
+          the generated decays do not depend on whether the table entry
+          existed) from a large number of decays. The table is never
+          updated from the decays generated for events, which therefore do
+          not depend on the decays generated earlier by the same process.
+          The table is kept in the GENIE Cache so it can be saved and
+          reused by later jobs (see Cache::OpenCacheFile()).
+          For 2-body decays the TGenPhaseSpace weight is constant and
+          unweighted decays are generated without any max weight estimate.
+
+\author   The GENIE Collaboration
+          Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+          STFC, Rutherford Appleton Laboratory
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _N_BODY_PHASE_SPACE_H_
+#define _N_BODY_PHASE_SPACE_H_
+
+#include <string>
+#include <vector>
+
+#include <TGenPhaseSpace.h>
+#include <TLorentzVector.h>
+
+class TRandom;
+
+using std::string;
+using std::vector;
+
+namespace genie {
+
+class CacheBranchFx;
+
+class NBodyPhaseSpace {
+
+public :
+  NBodyPhaseSpace();
+ ~NBodyPhaseSpace();
+
+  //! Set the decay. Returns false if not permitted kinematically.
+  bool SetDecay (TLorentzVector & p4, int n, const double * mass);
+
+  //! Generate a weighted decay (as TGenPhaseSpace::Generate()) 
+  double Generate (void);
+
+  //! Generate an unweighted decay with the rejection method, using the max
+  //! weight scaled up by the input safety factor. Returns false if no decay
+  //! was accepted after controls::kMaxUnweightDecayIterations attempts.
+  bool GenerateUnweighted (TRandom & rnd, double safety_factor = 2.);
+
+  //! Max weight for the current decay (looked up or estimated & tabulated)
+  double MaxWeight (void);
+
+  //! Decay products 4-momenta for the last generated decay
+  TLorentzVector * GetDecay (int i) { return fGenerator.GetDecay(i); }
+  int              NDecay   (void) const { return fNDecay; }
+
+  //! Number of decays used for estimating the max weight of a new table entry
+  static const int kNMaxWeightDecays = 1000;
+
+private:
+
+  CacheBranchFx * MaxWeightTable (void);
+  double          QBin           (void) const;
+
+  TGenPhaseSpace fGenerator; ///< the ROOT phase space generator
+  int            fNDecay;    ///< number of decay products
+  vector<double> fMass;      ///< decay product masses
+  string         fMassKey;   ///< decay product masses (max weight table key)
+  double         fQ;         ///< available kinetic energy of current decay
+};
+
+}      // genie namespace
+
+#endif // _N_BODY_PHASE_SPACE_H_
@@ -0,0 +1,130 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+         Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+         STFC, Rutherford Appleton Laboratory
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+
+#include <TMath.h>
+
+#include "Messenger/Messenger.h"
+#include "Utils/NuclearDensityTable.h"
+#include "Utils/NuclearUtils.h"
+
+using std::upper_bound;
+
+using namespace genie;
+
+//____________________________________________________________________________
+const double NuclearDensityTable::kRMaxOverA13 = 5.0; 
+//____________________________________________________________________________
+NuclearDensityTable * NuclearDensityTable::fInstance = 0;
+//____________________________________________________________________________
+NuclearDensityTable::NuclearDensityTable()
+{
+  fInstance =  0;
+}
+//____________________________________________________________________________
+NuclearDensityTable::~NuclearDensityTable()
+{
+  fTables.clear();
+  fInstance = 0;
+}
+//____________________________________________________________________________
+NuclearDensityTable * NuclearDensityTable::Instance()
+{
+  if(fInstance == 0) {
+    static NuclearDensityTable::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new NuclearDensityTable;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+double NuclearDensityTable::RMax(int A) const
+{
+  return kRMaxOverA13 * TMath::Power(A, 1./3.);
+}
+//____________________________________________________________________________
+double NuclearDensityTable::Density(double r, int A) const
+{
+  const DensityTable_t & table = this->Table(A);
+
+  double x = r / table.dr;
+  int    i = (int) x;
+  if(r < 0 || i >= kNRadialPoints-1) {
+    return utils::nuclear::Density(r,A);
+  }
+  double f = x - i;
+  return (1-f) * table.density[i] + f * table.density[i+1];
+}
+//____________________________________________________________________________
+double NuclearDensityTable::SelectRadius(int A, double rmax, double u) const
+{
+  const DensityTable_t & table = this->Table(A);
+
+  // cumulative distribution at rmax
+  double cmax = table.cdf[kNRadialPoints-1];
+  double x    = rmax / table.dr;
+  int    imax = (int) x;
+  if(imax < kNRadialPoints-1) {
+    double f = x - imax;
+    cmax = (1-f) * table.cdf[imax] + f * table.cdf[imax+1];
+  }
+
+  // invert the cumulative distribution
+  double c = u * cmax;
+  vector<double>::const_iterator iter = 
+        upper_bound(table.cdf.begin(), table.cdf.end(), c);
+  int i = (iter - table.cdf.begin()) - 1;
+  i = TMath::Max(0, TMath::Min(i, kNRadialPoints-2));
+
+  double c0 = table.cdf[i];
+  double c1 = table.cdf[i+1];
+  double f  = (c1 > c0) ? (c-c0)/(c1-c0) : 0.;
+
+  return TMath::Min((i+f) * table.dr, rmax);
+}
+//____________________________________________________________________________
+const NuclearDensityTable::DensityTable_t & 
+                                 NuclearDensityTable::Table(int A) const
+{
+  map<int, DensityTable_t>::const_iterator iter = fTables.find(A);
+  if(iter != fTables.end()) return iter->second;
+
+  DensityTable_t table;
+  table.dr = this->RMax(A) / (kNRadialPoints-1);
+  table.density.resize(kNRadialPoints);
+  table.cdf.resize(kNRadialPoints);
+
+  // tabulate the density and integrate r^2 rho(r) (trapezoidal rule)
+  double yprev = 0;
+  for(int i = 0; i < kNRadialPoints; i++) {
+    double r   = i * table.dr;
+    double rho = utils::nuclear::Density(r,A);
+    double y   = r*r * rho;
+    table.density[i] = rho;
+    table.cdf[i] = (i==0) ? 0. : table.cdf[i-1] + 0.5*(y+yprev)*table.dr;
+    yprev = y;
+  }
+
+  LOG("Nuclear", pNOTICE) 
+     << "Tabulated nuclear density for A = " << A << " in r = [0, " 
+     << this->RMax(A) << "] fm (" << kNRadialPoints << " points)";
+
+  return fTables.insert(
+           map<int, DensityTable_t>::value_type(A, table)).first->second;
+}
+//____________________________________________________________________________
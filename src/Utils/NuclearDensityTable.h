@@ -0,0 +1,89 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NuclearDensityTable
+
+\brief    Tabulated nuclear density profiles, as given by
+          utils::nuclear::Density(), and the corresponding cumulative radial
+          distributions int_{0}^{r} r'^2 rho(r') dr'.
+          The tables are built the first time a nucleus (A) is requested and
+          are shared by all clients in the process. They are used for
+          selecting radial positions within the nucleus (eg the interaction
+          vertex) by inverting the cumulative distribution, and for fast
+          density lookups (eg in intranuclear hadron transport).
+
+\author   The GENIE Collaboration
+          Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+          STFC, Rutherford Appleton Laboratory
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _NUCLEAR_DENSITY_TABLE_H_
+#define _NUCLEAR_DENSITY_TABLE_H_
+
+#include <map>
+#include <vector>
+
+using std::map;
+using std::vector;
+
+namespace genie {
+
+class NuclearDensityTable
+{
+public:
+  static NuclearDensityTable * Instance (void);
+
+  //! Nuclear density (fm^-3) at radius r (fm), interpolated from the table.
+  //! Outside the tabulated range utils::nuclear::Density() is evaluated.
+  double Density (double r, int A) const;
+
+  //! Radius (fm) distributed as r^2*rho(r) in [0, rmax], for the input 
+  //! uniform deviate u in [0,1). rmax is limited to the tabulated range.
+  double SelectRadius (int A, double rmax, double u) const;
+
+  //! Max tabulated radius (fm) for the input nucleus
+  double RMax (int A) const;
+
+  //! Number of points of each table and range in units of A^(1/3) fm
+  static const int    kNRadialPoints = 1000;
+  static const double kRMaxOverA13;
+
+private:
+  NuclearDensityTable();
+  NuclearDensityTable(const NuclearDensityTable & table);
+  virtual ~NuclearDensityTable();
+
+  typedef struct EDensityTable {
+    double         dr;       ///< radial step (fm)
+    vector<double> density;  ///< rho(r_i)
+    vector<double> cdf;      ///< int_{0}^{r_i} r^2 rho(r) dr
+  } DensityTable_t;
+
+  const DensityTable_t & Table (int A) const;
+
+  static NuclearDensityTable * fInstance;
+
+  mutable map<int, DensityTable_t> fTables; ///< tables built so far, by A
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (NuclearDensityTable::fInstance !=0) {
+            delete NuclearDensityTable::fInstance;
+            NuclearDensityTable::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _NUCLEAR_DENSITY_TABLE_H_
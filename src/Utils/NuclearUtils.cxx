@@ -347,6 +347,28 @@ double genie::utils::nuclear::DISNuclFactor(double x, int A)
 double genie::utils::nuclear::Density(double r, int A, double ring)
 {
 // [by S.Dytman]
+//
+  double radius = 0., shape = 0.;
+  bool woods_saxon = DensityParams(A, radius, shape);
+
+  if(woods_saxon) {
+    LOG("Nuclear",pINFO)
+	<< "r= " << r << ", ring= " << ring;
+    double rho = DensityWoodsSaxon(r,radius,shape,ring);
+    return rho;
+  }
+
+  double rho = DensityGaus(r,radius,shape,ring);
+  return rho;
+}
+//___________________________________________________________________________
+bool genie::utils::nuclear::DensityParams(
+                                 int A, double & radius, double & shape)
+{
+// Parameters of the nuclear density profile used in Density() for the input
+// mass number [by S.Dytman].
+// Returns true for a Woods-Saxon profile (A>20; radius = c, shape = z) and
+// false for a modified harmonic osc. profile (radius = ap, shape = alf).
 //
   if(A>20) {
     double c = 1., z = 1.;
@@ -360,10 +382,9 @@ double genie::utils::nuclear::Density(double r, int A, double ring)
        c = TMath::Power(A,0.35); z = 0.54; 
     } //others
 
-    LOG("Nuclear",pINFO)
-	<< "r= " << r << ", ring= " << ring;
-    double rho = DensityWoodsSaxon(r,c,z,ring);
-    return rho;
+    radius = c;
+    shape  = z;
+    return true;
   }
   else if (A>4) {
     double ap = 1., alf = 1.;
@@ -376,18 +397,15 @@ double genie::utils::nuclear::Density(double r, int A, double ring)
       ap=1.75; alf=-0.4+.12*A; 
     }  //others- alf=0.08 if A=4
 
-    double rho = DensityGaus(r,ap,alf,ring);
-    return rho;
-  }
-  else {
-    // helium
-    double ap = 1.9/TMath::Sqrt(2.);  
-    double alf=0.;    
-    double rho = DensityGaus(r,ap,alf,ring);
-    return rho;
+    radius = ap;
+    shape  = alf;
+    return false;
   }
 
-  return 0;
+  // helium
+  radius = 1.9/TMath::Sqrt(2.);  
+  shape  = 0.;    
+  return false;
 }
 //___________________________________________________________________________
 double genie::utils::nuclear::DensityGaus(
@@ -55,6 +55,7 @@ namespace nuclear
   double DISNuclFactor (double x, int A);
 
   double Density           (double r, int A, double ring=0.);
+  bool   DensityParams     (int A, double & radius, double & shape);
   double DensityGaus       (double r, double ap, double alf, double ring=0.);
   double DensityWoodsSaxon (double r, double c, double z, double ring=0.);
 
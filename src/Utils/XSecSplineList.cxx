@@ -39,14 +39,23 @@
 */
 //____________________________________________________________________________
 
+#include <algorithm>
 #include <fstream>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
 #include "libxml/xmlreader.h"
 
 #include <TSystem.h>
+#include <TString.h>
 #include <TMath.h>
 #include <TLorentzVector.h>
 
@@ -63,6 +72,12 @@
 using std::ofstream;
 using std::endl;
 
+// adaptive knot placement: number of knots of the initial (coarse) grid
+// above threshold & cross section floor, relative to the spline maximum,
+// used when comparing spline and computed cross sections
+static const int    kNKnotsCoarse = 10;
+static const double kXSecFloor    = 1E-3;
+
 namespace genie {
 
 //____________________________________________________________________________
@@ -79,8 +94,12 @@ XSecSplineList::XSecSplineList()
   fInstance    =  0;
   fUseLogE     = true;
   fNKnots      = 100;
+  fKnotTol     = 0.;
   fEmin        =   0.01; // GeV
   fEmax        = 100.00; // GeV
+  fWorkerId    = 0;
+  fNWorkers    = 1;
+  fGeneration  = 0;
 }
 //____________________________________________________________________________
 XSecSplineList::~XSecSplineList()
@@ -97,6 +116,9 @@ XSecSplineList::~XSecSplineList()
       spline = 0;
     }
   }
+  for(unsigned int i = 0; i < fBinArchives.size(); i++) {
+    munmap(fBinArchives[i].first, fBinArchives[i].second);
+  }
   fInstance = 0;
 }
 //____________________________________________________________________________
@@ -114,8 +136,7 @@ XSecSplineList * XSecSplineList::Instance()
 bool XSecSplineList::SplineExists(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
-  string key = this->BuildSplineKey(alg,interaction);
-  return this->SplineExists(key);
+  return (this->FindSpline(alg,interaction) != 0);
 }
 //____________________________________________________________________________
 bool XSecSplineList::SplineExists(string key) const
@@ -131,15 +152,20 @@ bool XSecSplineList::SplineExists(string key) const
 const Spline * XSecSplineList::GetSpline(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
-  string key = this->BuildSplineKey(alg,interaction);
-  return this->GetSpline(key);
+  const Spline * spline = this->FindSpline(alg,interaction);
+  if(!spline) {
+    SLOG("XSecSplLst", pWARN) 
+      << "Couldn't find spline for key = " 
+      << this->BuildSplineKey(alg,interaction);
+  }
+  return spline;
 }
 //____________________________________________________________________________
 const Spline * XSecSplineList::GetSpline(string key) const
 {
-  if ( this->SplineExists(key) ) {
-     map<string, Spline *>::const_iterator iter = fSplineMap.find(key);
-     return iter->second;
+  map<string, Spline *>::iterator iter = fSplineMap.find(key);
+  if ( iter != fSplineMap.end() ) {
+     return this->SplineAt(iter);
   } else {
     SLOG("XSecSplLst", pWARN) << "Couldn't find spline for key = " << key;
     return 0;
@@ -147,6 +173,34 @@ const Spline * XSecSplineList::GetSpline(string key) const
   return 0;
 }
 //____________________________________________________________________________
+const Spline * XSecSplineList::FindSpline(
+            const XSecAlgorithmI * alg, const Interaction * interaction) const
+{
+// Look-up the spline by (algorithm, interaction code) first and fall back
+// to the string key only the first time a given spline is requested.
+// Algorithm objects are owned by the AlgFactory and live for the entire job
+// so their address is a valid key. Misses are not indexed so that splines
+// created or loaded later on are always found.
+
+  SplineIndexKey_t ikey(alg, interaction->Code());
+
+  map<SplineIndexKey_t, const Spline *>::const_iterator iiter = 
+                                                    fSplineIndex.find(ikey);
+  if(iiter != fSplineIndex.end()) return iiter->second;
+
+  string key = this->BuildSplineKey(alg,interaction);
+  SLOG("XSecSplLst", pDEBUG) << "Checking for spline with key = " << key;
+
+  map<string, Spline *>::iterator iter = fSplineMap.find(key);
+  if(iter == fSplineMap.end()) return 0;
+
+  const Spline * spline = this->SplineAt(iter);
+  fSplineIndex.insert(
+      map<SplineIndexKey_t, const Spline *>::value_type(ikey, spline));
+
+  return spline;
+}
+//____________________________________________________________________________
 void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
         const Interaction * interaction, int nknots, double Emin, double Emax)
 {
@@ -155,14 +209,24 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
 // For building this specific entry of the spline list, the user is allowed
 // to override the list-wide nknots,Emin,Emax
 
-  double xsec[nknots];
-  double E   [nknots];
+  string key = this->BuildSplineKey(alg,interaction);
+
+  // If the work is shared among several processes, build only this
+  // process' share of the requested splines. Splines are assigned to
+  // processes from their key, so that the assignment does not depend on
+  // which splines each process has already built or loaded.
+  //
+  int iworker = this->SplineWorker(key);
+  if (iworker != fWorkerId) {
+     SLOG("XSecSplLst", pINFO)
+        << "Spline: " << key << " is built by process: "
+        << iworker << " - Skipping";
+     return;
+  }
 
   SLOG("XSecSplLst", pNOTICE)
      << "Creating cross section spline using the algorithm: " << *alg;
 
-  string key = this->BuildSplineKey(alg,interaction);
-
   // If any of the nknots,Emin,Emax was not set or its value is not acceptable
   // use the list values
   //
@@ -179,13 +243,21 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   //   above the input interaction threshold
   // The above scheme schanges appropriately if Ethr<Emin (i.e. no knots
   // are computed below threshold)
+  // In adaptive mode only a coarse grid is placed above threshold and the
+  // remaining knots (up to n) are added where needed (see RefineKnots()).
   //
   double Ethr = interaction->PhaseSpace().Threshold();
   SLOG("XSecSplLst", pNOTICE)
     << "Energy threshold for current interaction = " << Ethr << " GeV";
 
+  bool adaptive = this->UseAdaptiveKnots();
+
   int nkb = (Ethr>Emin) ? 5 : 0; // number of knots <  threshold
   int nka = nknots-nkb;          // number of knots >= threshold
+  if(adaptive) nka = TMath::Min(nka, kNKnotsCoarse);
+
+  vector<double> E   (nkb+nka);
+  vector<double> xsec(nkb+nka);
 
   // knots < energy threshold
   double dEb =  (Ethr>Emin) ? (Ethr - Emin) / nkb : 0;
@@ -210,21 +282,97 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   // Compute cross sections for the input interaction at the selected
   // set of energies
   //
-  for (int i = 0; i < nknots; i++) {
-    TLorentzVector p4(0,0,E[i],E[i]);
-    interaction->InitStatePtr()->SetProbeP4(p4);
-    xsec[i] = alg->Integral(interaction);
-    SLOG("XSecSplLst", pNOTICE)
-            << "xsec(E = " << E[i] << ") = " 
-                       << (1E+38/units::cm2)*xsec[i] << " x 1E-38 cm^2";
+  for (unsigned int i = 0; i < E.size(); i++) {
+    xsec[i] = this->ComputeXSec(alg, interaction, E[i]);
+  }
+
+  // Add knots where the spline does not reproduce the cross section
+  //
+  if(adaptive) {
+    this->RefineKnots(alg, interaction, nkb, nknots, E, xsec);
   }
 
   // Build & save the spline
   //
-  Spline * spline = new Spline(nknots, E, xsec);
+  Spline * spline = new Spline(E.size(), &E[0], &xsec[0]);
   fSplineMap.insert( map<string, Spline *>::value_type(key, spline) );
 }
 //____________________________________________________________________________
+double XSecSplineList::ComputeXSec(const XSecAlgorithmI * alg,
+                           const Interaction * interaction, double E) const
+{
+  TLorentzVector p4(0,0,E,E);
+  interaction->InitStatePtr()->SetProbeP4(p4);
+  double xsec = alg->Integral(interaction);
+  SLOG("XSecSplLst", pNOTICE)
+          << "xsec(E = " << E << ") = " 
+                     << (1E+38/units::cm2)*xsec << " x 1E-38 cm^2";
+  return xsec;
+}
+//____________________________________________________________________________
+void XSecSplineList::RefineKnots(const XSecAlgorithmI * alg,
+     const Interaction * interaction, int nkb, int nknots,
+     vector<double> & E, vector<double> & xsec) const
+{
+// Adaptive knot placement above the interaction threshold (knots [nkb,n)).
+// At each pass, the cross section is computed at the mid-point of every
+// interval not yet converged and compared with the spline built on the
+// current knots. The mid-point becomes a knot and, if the spline value was
+// not within the requested tolerance, both halves are refined further.
+// Refinement stops when all intervals have converged or when the knot
+// budget (nknots) is exhausted.
+
+  double tol  = this->KnotTolerance();
+  bool   logE = this->UseLogE();
+
+  // intervals (E[i],E[i+1]) pending refinement, by lower knot energy
+  vector<double> pending;
+  for(unsigned int i = nkb; i+1 < E.size(); i++) pending.push_back(E[i]);
+
+  int npass = 0;
+  while(!pending.empty() && (int)E.size() < nknots) {
+    npass++;
+    Spline spline(E.size(), &E[0], &xsec[0]);
+    double xsec_max = TMath::Max(
+       TMath::Abs(xsec[TMath::LocMax(xsec.size(), &xsec[0])]),
+       TMath::Abs(xsec[TMath::LocMin(xsec.size(), &xsec[0])]));
+
+    vector<double> next;
+    for(unsigned int ip = 0; ip < pending.size(); ip++) {
+       if((int)E.size() >= nknots) break;
+
+       vector<double>::iterator it =
+           std::lower_bound(E.begin(), E.end(), pending[ip]);
+       int    i     = it - E.begin();
+       double Elo   = E[i];
+       double Ehi   = E[i+1];
+       double Emid  = (logE) ? TMath::Sqrt(Elo*Ehi) : 0.5*(Elo+Ehi);
+       if(Emid <= Elo || Emid >= Ehi) continue; // interval can not be split
+
+       double xsec_spl = spline.Evaluate(Emid);
+       double xsec_mid = this->ComputeXSec(alg, interaction, Emid);
+
+       E   .insert(E.begin()    + i+1, Emid);
+       xsec.insert(xsec.begin() + i+1, xsec_mid);
+
+       // cross sections are compared relative to the local value, but
+       // not below a small fraction of the spline maximum
+       double scale = TMath::Max(TMath::Abs(xsec_mid), kXSecFloor*xsec_max);
+       bool converged = TMath::Abs(xsec_spl-xsec_mid) <= tol*scale;
+       if(!converged) {
+         next.push_back(Elo);
+         next.push_back(Emid);
+       }
+    }
+    pending = next;
+  }
+
+  SLOG("XSecSplLst", pNOTICE)
+     << "Adaptive knot placement settled on " << E.size() << " knots ("
+     << npass << " refinement passes, knot budget: " << nknots << ")"
+     << ((pending.empty()) ? "" : " - Knot budget exhausted before convergence");
+}
+//____________________________________________________________________________
 void XSecSplineList::SetLogE(bool on)
 {
   fUseLogE = on;
@@ -246,6 +394,29 @@ void XSecSplineList::SetMaxE(double Ev)
   if(Ev>0) fEmax = Ev;
 }
 //____________________________________________________________________________
+void XSecSplineList::SetKnotTolerance(double tol)
+{
+  fKnotTol = TMath::Max(0., tol);
+}
+//____________________________________________________________________________
+void XSecSplineList::SetWorkShare(int iworker, int nworkers)
+{
+  if(nworkers < 1 || iworker < 0 || iworker >= nworkers) {
+    SLOG("XSecSplLst", pERROR)
+       << "Invalid spline building share: " << iworker << "/" << nworkers;
+    return;
+  }
+  fWorkerId = iworker;
+  fNWorkers = nworkers;
+}
+//____________________________________________________________________________
+int XSecSplineList::SplineWorker(string key) const
+{
+  if(fNWorkers <= 1) return 0;
+
+  return TString(key.c_str()).Hash() % fNWorkers;
+}
+//____________________________________________________________________________
 void XSecSplineList::SaveAsXml(string filename) const
 {
 //! Save XSecSplineList to XML file
@@ -268,12 +439,12 @@ void XSecSplineList::SaveAsXml(string filename) const
                           << "version=\"2.00\" uselog=\"" << uselog << "\">";
   outxml << endl << endl;
 
-  map<string, Spline *>::const_iterator mapiter;
+  map<string, Spline *>::iterator mapiter;
 
   for(mapiter = fSplineMap.begin(); mapiter != fSplineMap.end(); ++mapiter) {
 
     string     key     = mapiter->first;
-    Spline *   spline  = mapiter->second;
+    Spline *   spline  = this->SplineAt(mapiter);
 
     spline->SaveAsXml(outxml,"E","xsec", key, true);
   }
@@ -294,7 +465,7 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(string filename, bool keep)
         << "Option to keep pre-existing splines is switched "
         << ( (keep) ? "ON" : "OFF" );
 
-  if(!keep) fSplineMap.clear();
+  if(!keep) this->ClearSplines();
 
   const int kNodeTypeStartElement = 1;
   const int kNodeTypeEndElement   = 15;
@@ -401,6 +572,256 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(string filename, bool keep)
   return kXmlOK;
 }
 //____________________________________________________________________________
+// Binary spline archive layout (native byte order, all blocks 8-byte aligned):
+//
+//  header : char[8] magic ("GENIESPL"), UInt_t byte order mark (0x01020304),
+//           UInt_t version, UInt_t uselog, UInt_t number of splines
+//  index  : per spline: UInt_t key length, UInt_t number of knots,
+//           ULong64_t offset of the knot arrays from the start of the file,
+//           the key characters (padded with 0's to a multiple of 8 bytes)
+//  data   : per spline: E[nknots] followed by xsec[nknots] (doubles)
+//
+namespace {
+  const char   kBinSplMagic[8] = { 'G','E','N','I','E','S','P','L' };
+  const UInt_t kBinSplBOM      = 0x01020304;
+  const UInt_t kBinSplVersion  = 1;
+  const size_t kBinSplHdrSize  = 8 + 4*sizeof(UInt_t);
+
+  inline size_t BinSplPad8(size_t n) { return (n + 7) & ~((size_t) 7); }
+}
+//____________________________________________________________________________
+void XSecSplineList::SaveAsBinary(string filename) const
+{
+//! Save XSecSplineList to a binary spline archive
+
+  SLOG("XSecSplLst", pNOTICE)
+       << "Saving XSecSplineList as binary archive in file: " << filename;
+
+  // The archive is written in a temporary file which then replaces the
+  // target file: The target may be mapped in memory and be in use by the
+  // list being saved, and it is never left half-written if the job dies.
+  string tmpfilename = filename + ".tmp";
+  ofstream out(tmpfilename.c_str(), std::ios::out | std::ios::binary);
+  if(!out.is_open()) {
+    SLOG("XSecSplLst", pERROR) << "Couldn't create file = " << tmpfilename;
+    return;
+  }
+
+  // collect the knots of all splines (splines still sitting in a mapped
+  // archive are copied as they are, without being built)
+  vector<string>                 keys;
+  vector<int>                    nknots;
+  vector<const double *>         px, py;
+  vector< vector<double> >       knots(fSplineMap.size());
+
+  map<string, Spline *>::const_iterator mapiter;
+  for(mapiter = fSplineMap.begin(); mapiter != fSplineMap.end(); ++mapiter) {
+    string         key    = mapiter->first;
+    const Spline * spline = mapiter->second;
+    if(spline) {
+      int n = spline->NKnots();
+      vector<double> & v = knots[keys.size()];
+      v.resize(2*n);
+      for(int i = 0; i < n; i++) spline->GetKnot(i, v[i], v[n+i]);
+      nknots.push_back(n);
+      px.push_back(&v[0]);
+      py.push_back(&v[n]);
+    } else {
+      map<string, BinSplineRef_t>::const_iterator biter = fBinSplines.find(key);
+      assert(biter != fBinSplines.end());
+      nknots.push_back(biter->second.nknots);
+      px.push_back(biter->second.x);
+      py.push_back(biter->second.y);
+    }
+    keys.push_back(key);
+  }
+  UInt_t nspl = keys.size();
+
+  // header
+  UInt_t bom = kBinSplBOM, version = kBinSplVersion, uselog = (fUseLogE ? 1 : 0);
+  out.write(kBinSplMagic, 8);
+  out.write((const char *) &bom,     sizeof(UInt_t));
+  out.write((const char *) &version, sizeof(UInt_t));
+  out.write((const char *) &uselog,  sizeof(UInt_t));
+  out.write((const char *) &nspl,    sizeof(UInt_t));
+
+  // index
+  size_t offset = kBinSplHdrSize;
+  for(UInt_t i = 0; i < nspl; i++) {
+    offset += 2*sizeof(UInt_t) + sizeof(ULong64_t) + BinSplPad8(keys[i].size());
+  }
+  const char zeros[8] = { 0,0,0,0,0,0,0,0 };
+  for(UInt_t i = 0; i < nspl; i++) {
+    UInt_t    keylen = keys[i].size();
+    UInt_t    n      = nknots[i];
+    ULong64_t off    = offset;
+    out.write((const char *) &keylen, sizeof(UInt_t));
+    out.write((const char *) &n,      sizeof(UInt_t));
+    out.write((const char *) &off,    sizeof(ULong64_t));
+    out.write(keys[i].c_str(), keylen);
+    out.write(zeros, BinSplPad8(keylen) - keylen);
+    offset += 2 * n * sizeof(double);
+  }
+
+  // knots
+  for(UInt_t i = 0; i < nspl; i++) {
+    out.write((const char *) px[i], nknots[i] * sizeof(double));
+    out.write((const char *) py[i], nknots[i] * sizeof(double));
+  }
+
+  out.close();
+  if(out.fail() || rename(tmpfilename.c_str(), filename.c_str()) != 0) {
+    SLOG("XSecSplLst", pERROR) << "Couldn't write file = " << filename;
+    unlink(tmpfilename.c_str());
+  }
+}
+//____________________________________________________________________________
+XmlParserStatus_t XSecSplineList::LoadFromBinary(string filename, bool keep)
+{
+//! Load XSecSplineList from a binary spline archive. Only the index is read
+//! here: the splines are built on first access. If keep = true, then the
+//! loaded splines are added to the existing list. If false, then the
+//! existing list is reseted before loading the splines.
+
+  SLOG("XSecSplLst", pNOTICE) << "Loading splines from: " << filename;
+  SLOG("XSecSplLst", pINFO)
+        << "Option to keep pre-existing splines is switched "
+        << ( (keep) ? "ON" : "OFF" );
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if(fd < 0) {
+    LOG("XSecSplLst", pERROR)
+          << "\nBinary spline file could not be opened! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+  struct stat st;
+  if(fstat(fd, &st) != 0 || (size_t) st.st_size < kBinSplHdrSize) {
+    close(fd);
+    LOG("XSecSplLst", pERROR)
+          << "\nBinary spline file is empty! [filename: " << filename << "]";
+    return kXmlEmpty;
+  }
+  size_t length = st.st_size;
+  void * addr = mmap(0, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(addr == MAP_FAILED) {
+    LOG("XSecSplLst", pERROR)
+          << "\nBinary spline file could not be mapped! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+
+  const char * base = (const char *) addr;
+  UInt_t hdr[4];
+  memcpy(hdr, base + 8, sizeof(hdr));
+
+  if(memcmp(base, kBinSplMagic, 8) != 0 || 
+     hdr[0] != kBinSplBOM || hdr[1] != kBinSplVersion) {
+    munmap(addr, length);
+    LOG("XSecSplLst", pERROR)
+      << "\nNot a binary spline archive (or incompatible one)! [filename: " 
+      << filename << "]";
+    return kXmlInvalidRoot;
+  }
+
+  if(!keep) this->ClearSplines();
+
+  this->SetLogE(hdr[2] == 1);
+  UInt_t nspl = hdr[3];
+
+  // read the index
+  map<string, BinSplineRef_t> entries;
+  size_t pos = kBinSplHdrSize;
+  for(UInt_t i = 0; i < nspl; i++) {
+    UInt_t    keylen = 0, n = 0;
+    ULong64_t off    = 0;
+    bool ok = (pos + 2*sizeof(UInt_t) + sizeof(ULong64_t) <= length);
+    if(ok) {
+      memcpy(&keylen, base + pos,                  sizeof(UInt_t));
+      memcpy(&n,      base + pos + sizeof(UInt_t), sizeof(UInt_t));
+      memcpy(&off,    base + pos + 2*sizeof(UInt_t), sizeof(ULong64_t));
+      pos += 2*sizeof(UInt_t) + sizeof(ULong64_t);
+      ok = (pos + keylen <= length) && (off % 8 == 0) &&
+           (off + 2 * (ULong64_t) n * sizeof(double) <= length);
+    }
+    if(!ok) {
+      munmap(addr, length);
+      LOG("XSecSplLst", pERROR)
+          << "\nCorrupted binary spline archive! [filename: " << filename << "]";
+      return kXmlNotParsed;
+    }
+    string key(base + pos, keylen);
+    pos += BinSplPad8(keylen);
+
+    BinSplineRef_t ref;
+    ref.x      = (const double *) (base + off);
+    ref.y      = ref.x + n;
+    ref.nknots = n;
+    entries.insert(map<string, BinSplineRef_t>::value_type(key, ref));
+  }
+
+  fBinArchives.push_back(pair<void *, size_t>(addr, length));
+
+  map<string, BinSplineRef_t>::const_iterator eiter;
+  for(eiter = entries.begin(); eiter != entries.end(); ++eiter) {
+    // as for XML files, a spline already in the list is not replaced
+    if(fSplineMap.count(eiter->first) == 1) continue;
+    fSplineMap.insert(map<string, Spline *>::value_type(eiter->first, 0));
+    fBinSplines.insert(*eiter);
+  }
+
+  SLOG("XSecSplLst", pNOTICE) 
+     << "Indexed " << nspl << " splines in binary archive " << filename;
+
+  return kXmlOK;
+}
+//____________________________________________________________________________
+XmlParserStatus_t XSecSplineList::LoadFromFile(string filename, bool keep)
+{
+  if(XSecSplineList::IsBinaryFile(filename)) {
+    return this->LoadFromBinary(filename, keep);
+  }
+  return this->LoadFromXml(filename, keep);
+}
+//____________________________________________________________________________
+bool XSecSplineList::IsBinaryFile(string filename)
+{
+  std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+  if(!in.is_open()) return false;
+
+  char magic[8];
+  in.read(magic, 8);
+  return (in.gcount() == 8 && memcmp(magic, kBinSplMagic, 8) == 0);
+}
+//____________________________________________________________________________
+Spline * XSecSplineList::SplineAt(map<string, Spline *>::iterator iter) const
+{
+// Return the spline at the input position of the spline map, building it
+// from the mapped binary archive if this is the first time it is requested
+
+  if(iter->second) return iter->second;
+
+  map<string, BinSplineRef_t>::const_iterator biter = 
+                                           fBinSplines.find(iter->first);
+  if(biter == fBinSplines.end()) return 0;
+
+  const BinSplineRef_t & ref = biter->second;
+  vector<double> E   (ref.x, ref.x + ref.nknots);
+  vector<double> xsec(ref.y, ref.y + ref.nknots);
+
+  SLOG("XSecSplLst", pINFO) << "Building spline: " << iter->first;
+  iter->second = new Spline(ref.nknots, &E[0], &xsec[0]);
+
+  return iter->second;
+}
+//____________________________________________________________________________
+void XSecSplineList::ClearSplines(void)
+{
+  fGeneration++;
+  fSplineMap.clear();
+  fSplineIndex.clear();
+  fBinSplines.clear();
+}
+//____________________________________________________________________________
 /*
 Below I am keeping a commented-out version the old LoadFromXml() method using 
 the tree-based libxml2 API. That has been replaced by the above method using
@@ -417,7 +838,7 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(string filename, bool keep)
      << "Option to keep pre-existing splines is switched "
      << ( (keep) ? "ON" : "OFF" );
 
-  if(!keep) fSplineMap.clear();
+  if(!keep) this->ClearSplines();
 
   xmlDocPtr xml_doc = xmlParseFile(filename.c_str() );
 
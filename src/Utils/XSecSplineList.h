@@ -5,6 +5,14 @@
 
 \brief    List of cross section vs energy splines
 
+          The list can be saved to / loaded from an XML file or a binary
+          spline archive. The archive holds an index (spline key, number of
+          knots, offset) followed by the knot energies and cross sections of
+          each spline stored as contiguous arrays of doubles. It is loaded
+          with mmap(): only the index is read at load time and each spline is
+          built the first time it is requested, so that only the splines a
+          job actually uses are paged in.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           STFC, Rutherford Appleton Laboratory
 
@@ -24,6 +32,8 @@
 #include <vector>
 #include <string>
 
+#include <Rtypes.h>
+
 #include "Conventions/XmlParserStatus.h"
 
 using std::map;
@@ -55,22 +65,43 @@ public:
   const int  NSplines (void) const { return fSplineMap.size();        }
   const bool IsEmpty  (void) const { return (fSplineMap.size() == 0); }
 
+  // Incremented whenever the list is cleared (eg when reloaded), so that the
+  // Spline pointers handed out earlier must no longer be used
+  unsigned int Generation (void) const { return fGeneration; }
+
   // Set XSecSplineList options
   void   SetLogE   (bool   on); ///< set opt to build splines as f(E) or as f(logE)
   void   SetNKnots (int    nk); ///< set default number of knots for building the spline
   void   SetMinE   (double Ev); ///< set default minimum energy for xsec splines
   void   SetMaxE   (double Ev); ///< set default maximum energy for xsec splines
+  void   SetKnotTolerance (double tol); ///< adaptive knot placement tolerance (0: fixed knots)
+
+  // Share the spline building among several processes: of all the splines
+  // requested via CreateSpline(), only those assigned to process iworker
+  // (from a hash of the spline key, see SplineWorker()) are actually built
+  void   SetWorkShare (int iworker, int nworkers);
+  int    SplineWorker (string key) const; ///< process building the spline with the input key
 
   // Read XSecSplineList options
   bool   UseLogE     (void) const { return fUseLogE;     }
   int    NKnots      (void) const { return fNKnots;      }
   double Emin        (void) const { return fEmin;        }
   double Emax        (void) const { return fEmax;        }
+  double KnotTolerance    (void) const { return fKnotTol;      }
+  bool   UseAdaptiveKnots (void) const { return fKnotTol > 0.; }
 
   // Save/load to/from XML file
   void               SaveAsXml   (string filename) const;
   XmlParserStatus_t  LoadFromXml (string filename, bool keep = false);
 
+  // Save/load to/from binary spline archive
+  void               SaveAsBinary   (string filename) const;
+  XmlParserStatus_t  LoadFromBinary (string filename, bool keep = false);
+
+  // Load from an XML file or a binary spline archive (detected automatically)
+  XmlParserStatus_t  LoadFromFile   (string filename, bool keep = false);
+  static bool        IsBinaryFile   (string filename);
+
   // Autosave/autoload
   bool AutoLoad (void);
   void AutoSave (void);
@@ -90,14 +121,40 @@ private:
   XSecSplineList(const XSecSplineList & spline_list);
   virtual ~XSecSplineList();
 
+  const Spline * FindSpline (const XSecAlgorithmI * alg, const Interaction * i) const;
+  Spline *       SplineAt   (map<string, Spline *>::iterator iter) const;
+  void           ClearSplines (void);
+  double         ComputeXSec  (const XSecAlgorithmI * alg, const Interaction * i, double E) const;
+  void           RefineKnots  (const XSecAlgorithmI * alg, const Interaction * i,
+                                   int nkb, int nknots, vector<double> & E, vector<double> & xsec) const;
+
   static XSecSplineList * fInstance;
 
   bool   fUseLogE;
   int    fNKnots;
   double fEmin;
   double fEmax;
+  double fKnotTol;        ///< adaptive knot placement: max relative spline/xsec difference
+
+  int    fWorkerId;       ///< spline building share: this process id
+  int    fNWorkers;       ///< spline building share: number of processes
+
+  unsigned int fGeneration; ///< number of times the list was cleared
+
+  mutable map<string, Spline *> fSplineMap; ///< xsec_alg_name/param_set/interaction -> Spline (0 if not yet built from a binary archive)
+
+  // knots of splines loaded from a binary archive and not yet built
+  typedef struct EBinSplineRef {
+    const double * x;
+    const double * y;
+    int            nknots;
+  } BinSplineRef_t;
+
+  map<string, BinSplineRef_t>     fBinSplines;  ///< spline key -> knots in mapped archive
+  vector< pair<void *, size_t> >  fBinArchives; ///< mapped binary archives (address, length)
 
-  map<string, Spline *> fSplineMap; ///< xsec_alg_name/param_set/interaction -> Spline
+  typedef pair<const XSecAlgorithmI *, ULong64_t> SplineIndexKey_t;
+  mutable map<SplineIndexKey_t, const Spline *> fSplineIndex; ///< (xsec_alg, Interaction::Code()) -> Spline, filled on look-up
 
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
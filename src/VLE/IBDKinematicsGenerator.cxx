@@ -209,13 +209,13 @@ void IBDKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 //___________________________________________________________________________
 void IBDKinematicsGenerator::Configure(const Registry & config)
 {
-  Algorithm::Configure(config);
+  KineGeneratorWithCache::Configure(config);
   this->LoadConfig();
 }
 //____________________________________________________________________________
 void IBDKinematicsGenerator::Configure(string config)
 {
-  Algorithm::Configure(config);
+  KineGeneratorWithCache::Configure(config);
   this->LoadConfig();
 }
 //____________________________________________________________________________
@@ -32,6 +32,11 @@
                   [--event-record-print-level level]
                   [--mc-job-status-refresh-rate  rate]
                   [--cache-file root_file]
+                  [--workers n]
+                  [--ntp-format format]
+                  [--ntp-async-buffer size]
+                  [--ntp-compression algorithm,level]
+                  [--ntp-basket-size size]
 
          Options :
            [] Denotes an optional argument.
@@ -75,6 +80,9 @@
               ** Only use that option if you understand what it means **
            --seed
               Random number seed.
+              All random number streams are re-seeded at the start of each
+              event using a key built from the seed, the run number and the 
+              event number, so any event can be regenerated on its own.
            --cross-sections
               Name (incl. full path) of an XML file with pre-computed
               cross-section values used for constructing splines.
@@ -97,6 +105,33 @@
            --cache-file                  
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --workers
+              Number of parallel event generation worker processes.
+              The workers are forked after the (expensive) event generation
+              driver configuration, so that they all share the loaded splines.
+              Worker i uses the random number seed `seed+i' and generates
+              a contiguous block of event numbers. The worker outputs are
+              merged into a single output file at the end of the job.
+              [default: 1]
+           --ntp-format
+              Output ntuple format. It can be either `ghep' (full GHEP event
+              records) or `flat' (flat columnar event summaries, see
+              NtpMCFlatRecord, written directly without a gntpc pass).
+              [default: ghep]
+           --ntp-async-buffer
+              Write the output ntuple asynchronously: The event tree is
+              filled, compressed and saved by a separate writer process, so
+              that event generation does not stall while ROOT flushes its
+              baskets. The option specifies how many MB of generated events
+              may be buffered before event generation waits for the writer.
+              [default: synchronous output]
+           --ntp-compression
+              ROOT compression algorithm and level for the output ntuple
+              (eg `1,1' for zlib level 1, `2,5' for lzma level 5).
+              [default: ROOT default]
+           --ntp-basket-size
+              Basket size (in bytes) of the output event branch.
+              [default: 32000]
 
 	***  See the User Manual for more details and examples. ***
 
@@ -121,6 +156,7 @@
 #include <TFile.h>
 #include <TTree.h>
 #include <TSystem.h>
+#include <TMath.h>
 #include <TVector3.h>
 #include <TH1.h>
 #include <TF1.h>
@@ -129,10 +165,12 @@
 #include "Conventions/GBuild.h"
 #include "Conventions/Controls.h"
 #include "EVGCore/EventRecord.h"
+#include "EVGCore/EventRecordPool.h"
 #include "EVGDrivers/GFluxI.h"
 #include "EVGDrivers/GEVGDriver.h"
 #include "EVGDrivers/GMCJDriver.h"
 #include "EVGDrivers/GMCJMonitor.h"
+#include "EVGDrivers/GMCJWorkerPool.h"
 #include "Interaction/Interaction.h"
 #include "Messenger/Messenger.h"
 #include "Ntuple/NtpWriter.h"
@@ -179,6 +217,10 @@ GFluxI *        TH1FluxDriver           (void);
 #endif
 
 void GenerateEventsAtFixedInitState (void);
+string WorkerNtpFilename   (const GMCJWorkerPool & workers, int iworker);
+void MergeWorkerOutputs    (const GMCJWorkerPool & workers);
+void ConfigureNtpWriter    (NtpWriter & ntpw, bool allow_async = true);
+void SaveNtpWriter         (NtpWriter & ntpw);
 
 //Default options (override them using the command line arguments):
 int           kDefOptNevents   = 0;       // n-events to generate
@@ -197,6 +239,12 @@ bool            gOptWeighted;     //
 bool            gOptUsingFluxOrTgtMix = false;
 long int        gOptRanSeed;      // random number seed
 string          gOptInpXSecFile;  // cross-section splines
+int             gOptNWorkers;     // number of event generation worker processes
+NtpMCFormat_t   gOptNtpFormat;    // output ntuple format
+int             gOptNtpAsyncBuf;  // async ntuple writer buffer size (MB), 0 if synchronous
+int             gOptNtpCompAlg;   // ntuple compression algorithm (-1: ROOT default)
+int             gOptNtpCompLevel; // ntuple compression level (-1: ROOT default)
+int             gOptNtpBasketSize;// ntuple event branch basket size
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -252,8 +300,21 @@ void GenerateEventsAtFixedInitState(void)
   evg_driver.SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
   evg_driver.Configure(init_state);
 
+  // Fork the event generation workers (if requested).
+  // The master process just merges the worker outputs.
+  GMCJWorkerPool workers(gOptNWorkers);
+  int iworker = workers.Fork();
+  if(workers.IsMaster()) {
+    MergeWorkerOutputs(workers);
+    return;
+  }
+  int first_event = workers.FirstEvent(gOptNevents);
+  int last_event  = first_event + workers.NEvents(gOptNevents);
+
   // Initialize an Ntuple Writer
-  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
+  NtpWriter ntpw(gOptNtpFormat, gOptRunNu);
+  ntpw.CustomizeFilename(WorkerNtpFilename(workers, iworker));
+  ConfigureNtpWriter(ntpw);
   ntpw.Initialize();
 
   // Create an MC Job Monitor
@@ -261,15 +322,23 @@ void GenerateEventsAtFixedInitState(void)
   mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
 
   LOG("gevgen", pNOTICE) 
-    << "\n ** Will generate " << gOptNevents << " events for \n" 
+    << "\n ** Will generate " << last_event - first_event << " events for \n" 
     << init_state << " at Ev = " << Ev << " GeV";
 
   // Generate events / print the GHEP record / add it to the ntuple
-  int ievent = 0;
-  while (ievent < gOptNevents) {
+  int ievent = first_event;
+  int ikeyed  = -1;
+  while (ievent < last_event) {
      LOG("gevgen", pNOTICE) 
         << " *** Generating event............ " << ievent;
 
+     // re-seed the random number streams at the first attempt to generate
+     // each event, so that any event can be regenerated on its own
+     if(ievent != ikeyed) {
+        RandomGen::Instance()->SetEventKey(gOptRunNu, ievent);
+        ikeyed = ievent;
+     }
+
      // generate a single event
      EventRecord * event = evg_driver.GenerateEvent(nu_p4);
 
@@ -282,15 +351,75 @@ void GenerateEventsAtFixedInitState(void)
      LOG("gevgen", pNOTICE) 
 	<< "Generated Event GHEP Record: " << *event;
 
-     // add event at the output ntuple, refresh the mc job monitor & clean up
+     // add event at the output ntuple, refresh the mc job monitor & recycle
+     // the event record
      ntpw.AddEventRecord(ievent, event);
-     mcjmonitor.Update(ievent,event);
+     if(iworker == 0) mcjmonitor.Update(ievent,event);
      ievent++;
-     delete event;
+     EventRecordPool::Instance()->Release(event);
   }
 
   // Save the generated MC events
-  ntpw.Save();
+  SaveNtpWriter(ntpw);
+}
+//____________________________________________________________________________
+string WorkerNtpFilename(const GMCJWorkerPool & workers, int iworker)
+{
+// Output file for the given worker. Without parallel workers this is just
+// the default output filename (gntp.[run].ghep.root)
+
+  ostringstream filename;
+  filename << workers.WorkerFilenamePrefix("gntp", iworker) << "." 
+           << gOptRunNu << "."
+           << NtpMCFormat::FilenameTag(gOptNtpFormat) << ".root";
+  return filename.str();
+}
+//____________________________________________________________________________
+void MergeWorkerOutputs(const GMCJWorkerPool & workers)
+{
+// Merge the worker outputs, in worker order, into the job output file.
+// Each worker has generated a contiguous block of event numbers, so the
+// merged event tree is ordered by event number.
+
+  NtpWriter ntpw(gOptNtpFormat, gOptRunNu);
+  ConfigureNtpWriter(ntpw, false);
+  ntpw.Initialize();
+
+  for(int iw = 0; iw < workers.NWorkers(); iw++) {
+     string filename = WorkerNtpFilename(workers, iw);
+     bool ok = ntpw.AddEventRecords(filename);
+     if(!ok) {
+        LOG("gevgen", pFATAL) 
+          << "Could not merge the output of worker " << iw;
+        gAbortingInErr = true;
+        exit(1);
+     }
+     gSystem->Unlink(filename.c_str());
+  }
+
+  // Save the merged MC events
+  SaveNtpWriter(ntpw);
+}
+//____________________________________________________________________________
+void ConfigureNtpWriter(NtpWriter & ntpw, bool allow_async)
+{
+// Apply the output options. The asynchronous mode is not used for merging
+// the worker outputs (NtpWriter::AddEventRecords() needs the event tree).
+
+  if(allow_async && gOptNtpAsyncBuf > 0) {
+    ntpw.EnableAsyncOutput(true, 1000000 * (unsigned int)gOptNtpAsyncBuf);
+  }
+  ntpw.SetCompression(gOptNtpCompAlg, gOptNtpCompLevel);
+  ntpw.SetBasketSize(gOptNtpBasketSize);
+}
+//____________________________________________________________________________
+void SaveNtpWriter(NtpWriter & ntpw)
+{
+  if(!ntpw.Save()) {
+    LOG("gevgen", pFATAL) << "Could not save the generated events";
+    gAbortingInErr = true;
+    exit(1);
+  }
 }
 //____________________________________________________________________________
 
@@ -313,8 +442,24 @@ void GenerateEventsUsingFluxOrTgtMix(void)
   if(!gOptWeighted) 
 	mcj_driver->ForceSingleProbScale();
 
+  // Fork the event generation workers (if requested).
+  // Each gets its own copy of the configured MC job driver.
+  GMCJWorkerPool workers(gOptNWorkers);
+  int iworker = workers.Fork();
+  if(workers.IsMaster()) {
+    MergeWorkerOutputs(workers);
+    delete flux_driver;
+    delete geom_driver;
+    delete mcj_driver;
+    return;
+  }
+  int first_event = workers.FirstEvent(gOptNevents);
+  int last_event  = first_event + workers.NEvents(gOptNevents);
+
   // Initialize an Ntuple Writer to save GHEP records into a TTree
-  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
+  NtpWriter ntpw(gOptNtpFormat, gOptRunNu);
+  ntpw.CustomizeFilename(WorkerNtpFilename(workers, iworker));
+  ConfigureNtpWriter(ntpw);
   ntpw.Initialize();
 
   // Create an MC Job Monitor
@@ -322,25 +467,30 @@ void GenerateEventsUsingFluxOrTgtMix(void)
   mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
 
   // Generate events / print the GHEP record / add it to the ntuple
-  int ievent = 0;
-  while ( ievent < gOptNevents) {
+  int ievent = first_event;
+  while ( ievent < last_event) {
 
      LOG("gevgen", pNOTICE) << " *** Generating event............ " << ievent;
 
+     // re-seed the random number streams, so that any event can be 
+     // regenerated on its own
+     RandomGen::Instance()->SetEventKey(gOptRunNu, ievent);
+
      // generate a single event for neutrinos coming from the specified flux
      EventRecord * event = mcj_driver->GenerateEvent();
 
      LOG("gevgen", pNOTICE) << "Generated Event GHEP Record: " << *event;
 
-     // add event at the output ntuple, refresh the mc job monitor & clean-up
+     // add event at the output ntuple, refresh the mc job monitor & recycle
+     // the event record
      ntpw.AddEventRecord(ievent, event);
-     mcjmonitor.Update(ievent,event);
+     if(iworker == 0) mcjmonitor.Update(ievent,event);
      ievent++;
-     delete event;
+     EventRecordPool::Instance()->Release(event);
   }
 
   // Save the generated MC events
-  ntpw.Save();
+  SaveNtpWriter(ntpw);
 
   delete flux_driver;
   delete geom_driver;
@@ -653,6 +803,54 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  // number of event generation workers
+  if( parser.OptionExists("workers") ) {
+    LOG("gevgen", pINFO) << "Reading number of event generation workers";
+    gOptNWorkers = parser.ArgAsInt("workers");
+    if(gOptNWorkers < 1) {
+      LOG("gevgen", pFATAL) << "Invalid number of workers: " << gOptNWorkers;
+      PrintSyntax();
+      exit(1);
+    }
+  } else {
+    gOptNWorkers = 1;
+  }
+
+  // output ntuple writer options
+  gOptNtpFormat = kDefOptNtpFormat;
+  if( parser.OptionExists("ntp-format") ) {
+    string format = parser.ArgAsString("ntp-format");
+    if      (format == "ghep") gOptNtpFormat = kNFGHEP;
+    else if (format == "flat") gOptNtpFormat = kNFFlat;
+    else {
+      LOG("gevgen", pFATAL) << "Invalid ntuple format: " << format;
+      PrintSyntax();
+      exit(1);
+    }
+  }
+  gOptNtpAsyncBuf = 0;
+  if( parser.OptionExists("ntp-async-buffer") ) {
+    gOptNtpAsyncBuf = TMath::Max(1, parser.ArgAsInt("ntp-async-buffer"));
+  }
+  gOptNtpCompAlg   = -1;
+  gOptNtpCompLevel = -1;
+  if( parser.OptionExists("ntp-compression") ) {
+    vector<string> comp = utils::str::Split(
+         parser.ArgAsString("ntp-compression"), ",");
+    if(comp.size() != 2) {
+      LOG("gevgen", pFATAL) 
+        << "Invalid ntuple compression: " << parser.ArgAsString("ntp-compression");
+      PrintSyntax();
+      exit(1);
+    }
+    gOptNtpCompAlg   = atoi(comp[0].c_str());
+    gOptNtpCompLevel = atoi(comp[1].c_str());
+  }
+  gOptNtpBasketSize = 32000;
+  if( parser.OptionExists("ntp-basket-size") ) {
+    gOptNtpBasketSize = parser.ArgAsInt("ntp-basket-size");
+  }
+
   //
   // print-out the command line options
   //
@@ -670,6 +868,15 @@ void GetCommandLineArgs(int argc, char ** argv)
   }
   LOG("gevgen", pNOTICE) 
        << "Number of events requested: " << gOptNevents;
+  LOG("gevgen", pNOTICE) 
+       << "Number of event generation workers: " << gOptNWorkers;
+  LOG("gevgen", pNOTICE) 
+       << "Output ntuple format: " << NtpMCFormat::AsString(gOptNtpFormat);
+  if(gOptNtpAsyncBuf > 0) {
+     LOG("gevgen", pNOTICE) 
+       << "Asynchronous ntuple output, buffering up to " 
+       << gOptNtpAsyncBuf << " MB";
+  }
   if(gOptInpXSecFile.size() > 0) {
      LOG("gevgen", pNOTICE) 
        << "Using cross-section splines read from: " << gOptInpXSecFile;
@@ -726,6 +933,11 @@ void PrintSyntax(void)
     << "\n              [--event-record-print-level level]"
     << "\n              [--mc-job-status-refresh-rate  rate]"
     << "\n              [--cache-file root_file]"
+    << "\n              [--workers n]"
+    << "\n              [--ntp-format format]"
+    << "\n              [--ntp-async-buffer size]"
+    << "\n              [--ntp-compression algorithm,level]"
+    << "\n              [--ntp-basket-size size]"
     << "\n";
 }
 //____________________________________________________________________________
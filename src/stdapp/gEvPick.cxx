@@ -32,9 +32,14 @@
            e) NC coherent scattering. 
            Each such NC1pi0 source contributes differently to the pion momentum distribution.
 
+         Events are selected using the summary columns stored alongside the
+         GHEP record (see NtpMCEventSummary) whenever the input files have
+         them, so that only the GHEP records of cherry-picked events need to
+         be read. For older files, all GHEP records are read.
+
          Synopsis:
            gevpick -i list_of_input_files -t topology  
-                   [-o output_file]
+                   [-o output_file] [--workers n]
                    [--message-thresholds xmfile]
                    [--event-record-print-level level]
 
@@ -75,6 +80,12 @@
            -o 
               Specify output filename.
               (optional, default: gntp.<topology>.ghep.root)
+          --workers
+              Number of parallel worker processes (default: 1).
+              Each worker processes a contiguous block of the input files and
+              writes its own output file. Once all workers are done, their
+              outputs are merged (in worker order) so that the output does not
+              depend on the number of workers.
           --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
@@ -111,15 +122,18 @@
 #include <TTree.h>
 #include <TChain.h>
 #include <TChainElement.h>
+#include <TObjString.h>
 
 #include "Conventions/GBuild.h"
 #include "EVGCore/EventRecord.h"
+#include "EVGDrivers/GMCJWorkerPool.h"
 #include "GHEP/GHepStatus.h"
 #include "GHEP/GHepParticle.h"
 #include "GHEP/GHepUtils.h"
 #include "Ntuple/NtpMCFormat.h"
 #include "Ntuple/NtpMCTreeHeader.h"
 #include "Ntuple/NtpMCEventRecord.h"
+#include "Ntuple/NtpMCEventSummary.h"
 #include "Ntuple/NtpWriter.h"
 #include "Messenger/Messenger.h"
 #include "PDG/PDGCodes.h"
@@ -138,7 +152,9 @@ using namespace genie;
 // func prototypes
 void   GetCommandLineArgs (int argc, char ** argv);
 void   RunCherryPicker    (void);
-bool   AcceptEvent        (const EventRecord & event);
+void   MergeWorkerOutputs (const GMCJWorkerPool & workers);
+void   InitOutput         (NtpWriter & ntpw, string filename);
+bool   AcceptEvent        (const NtpMCEventSummary & summary);
 void   PrintSyntax        (void);
 string DefaultOutputFile  (void);
 
@@ -162,6 +178,11 @@ typedef enum EGPickTopo {
 string      gOptInpFileNames;  ///< input file name
 string      gOptOutFileName;   ///< output file name
 GPickTopo_t gPickedTopology;   ///< output file format id
+int         gOptNWorkers = 1;  ///< number of worker processes
+
+// book-keeping branches of the output event tree
+TObjString * gBrOrigFilename = 0; ///< name of the original file
+Long64_t     gBrOrigEvtNum   = 0; ///< event number in the original file
 
 //____________________________________________________________________________________
 int main(int argc, char ** argv)
@@ -178,20 +199,6 @@ int main(int argc, char ** argv)
 //____________________________________________________________________________________
 void RunCherryPicker(void)
 {
-  // Create an NtpWriter for writing out a tree with the cherry-picked events
-  // Add 2 additional branches to the output event tree to save the original filename
-  // and the event number in the original file (so that all info can be traced back 
-  // to its source).
-
-  NtpWriter ntpw(kNFGHEP, 0);
-  ntpw.CustomizeFilename(gOptOutFileName);
-  ntpw.Initialize();
-  TObjString* brOrigFilename = new TObjString;
-  Long64_t    brOrigEvtNum;
-  ntpw.EventTree()->Branch("orig_filename", "TObjString", &brOrigFilename, 5000,0);
-  ntpw.EventTree()->Branch("orig_evtnum", &brOrigEvtNum, "brOrigEvtNum/L");
-  Long64_t iev_glob = 0;
-
   // Load input trees. More than one trees can be loaded here if a wildcard was
   // specified with -f (eg -f /data/myfiles/genie/*.ghep.root)
 
@@ -204,14 +211,33 @@ void RunCherryPicker(void)
       << "Processing " << nfiles
       << (nfiles==1 ? " file " : " files ");
 
+  // Fork the workers (if more than one was requested). Each worker processes
+  // a contiguous block of input files, so that merging the worker outputs in
+  // worker order gives the same output as a single process.
+
+  GMCJWorkerPool workers(gOptNWorkers);
+  int iworker = workers.Fork();
+
+  if(workers.IsMaster()) {
+    MergeWorkerOutputs(workers);
+    LOG("gevpick", pFATAL) << "Done!";
+    return;
+  }
+
+  int ifirst  = workers.FirstEvent(nfiles);
+  int nwfiles = workers.NEvents(nfiles);
+
+  NtpWriter ntpw(kNFGHEP, 0);
+  InitOutput(ntpw, workers.WorkerFilenamePrefix(gOptOutFileName, iworker));
+  Long64_t iev_glob = 0;
+
   //
   // Loop over input event files
   //
 
-  TIter next_file(file_array);
-  TChainElement *chEl=0;
+  for(int ifile = ifirst; ifile < ifirst + nwfiles; ifile++) {
 
-  while (( chEl=(TChainElement*)next_file() )) {
+     TChainElement * chEl = (TChainElement *) file_array->At(ifile);
 
      TFile fin(chEl->GetTitle(),"read");
      TTree * ghep_tree = 
@@ -231,10 +257,18 @@ void RunCherryPicker(void)
        LOG("gevpick", pERROR) << "Null MC record";
        return;
      }
+     TBranch * mcrec_branch = ghep_tree->GetBranch("gmcrec");
+
+     // Use the summary columns (if available) to select events before
+     // reading their GHEP record
+     NtpMCEventSummary summary;
+     bool use_summary = summary.SetBranchAddresses(ghep_tree);
+
      Long64_t nmax = ghep_tree->GetEntries();
      LOG("gevpick", pNOTICE) 
         << "* Analyzing: " << nmax 
-        << " events from GHEP tree in file: " << chEl->GetTitle();
+        << " events from GHEP tree in file: " << chEl->GetTitle()
+        << (use_summary ? " (using summary columns)" : "");
 
      NtpMCTreeHeader * thdr = 
         dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
@@ -246,18 +280,28 @@ void RunCherryPicker(void)
      //
 
      for(Long64_t iev = 0; iev < nmax; iev++) {
-       ghep_tree->GetEntry(iev);
+       if(use_summary) {
+         summary.GetEntry(iev);
+         if(!AcceptEvent(summary)) continue;
+         mcrec_branch->GetEntry(iev);
+       } else {
+         ghep_tree->GetEntry(iev);
+         summary.Fill(mcrec->event);
+         if(!AcceptEvent(summary)) {
+           mcrec->Clear();
+           continue;
+         }
+       }
        NtpMCRecHeader rec_header = mcrec->hdr;
        EventRecord &  event      = *(mcrec->event);
        LOG("gevpick", pDEBUG) << rec_header;
        LOG("gevpick", pDEBUG) << event;
-       if(AcceptEvent(event)) {
-          brOrigFilename->SetString(chEl->GetTitle());
-          brOrigEvtNum = iev;
-          EventRecord * event_copy = new EventRecord(event);
-          ntpw.AddEventRecord(iev_glob,event_copy);
-          iev_glob++;
-       }
+
+       gBrOrigFilename->SetString(chEl->GetTitle());
+       gBrOrigEvtNum = iev;
+       ntpw.AddEventRecord(iev_glob,&event);
+       iev_glob++;
+
        mcrec->Clear();
 
     } // event loop (current file)
@@ -266,76 +310,96 @@ void RunCherryPicker(void)
   // save the cherry-picked MC events
   ntpw.Save();
   
-  LOG("gevpick", pFATAL) << "Done!";
+  if(!workers.IsParallel()) {
+    LOG("gevpick", pFATAL) << "Done!";
+  }
 }
 //____________________________________________________________________________________
-bool AcceptEvent(const EventRecord & event)
+void InitOutput(NtpWriter & ntpw, string filename)
+{
+  // Create an NtpWriter for writing out a tree with the cherry-picked events
+  // Add 2 additional branches to the output event tree to save the original filename
+  // and the event number in the original file (so that all info can be traced back 
+  // to its source).
+
+  ntpw.CustomizeFilename(filename);
+  ntpw.Initialize();
+  if(!gBrOrigFilename) gBrOrigFilename = new TObjString;
+  ntpw.EventTree()->Branch("orig_filename", "TObjString", &gBrOrigFilename, 5000,0);
+  ntpw.EventTree()->Branch("orig_evtnum", &gBrOrigEvtNum, "brOrigEvtNum/L");
+}
+//____________________________________________________________________________________
+void MergeWorkerOutputs(const GMCJWorkerPool & workers)
+{
+  // Copy the events cherry-picked by each worker (in worker order) to the
+  // output file, together with their book-keeping branches
+
+  NtpWriter ntpw(kNFGHEP, 0);
+  InitOutput(ntpw, gOptOutFileName);
+  Long64_t iev_glob = 0;
+
+  for(int iw = 0; iw < workers.NWorkers(); iw++) {
+
+     string filename = workers.WorkerFilenamePrefix(gOptOutFileName, iw);
+
+     TFile fin(filename.c_str(),"read");
+     TTree * tree = 
+        (fin.IsZombie()) ? 0 : dynamic_cast <TTree *> ( fin.Get("gtree") );
+     if(!tree) {
+        LOG("gevpick", pFATAL) 
+           << "No cherry-picked events found in " << filename;
+        gAbortingInErr = true;
+        exit(1);
+     }
+
+     NtpMCEventRecord * mcrec         = 0;
+     TObjString *       orig_filename = 0;
+     Long64_t           orig_evtnum   = 0;
+     tree->SetBranchAddress("gmcrec",        &mcrec);
+     tree->SetBranchAddress("orig_filename", &orig_filename);
+     tree->SetBranchAddress("orig_evtnum",   &orig_evtnum);
+
+     Long64_t nev = tree->GetEntries();
+     for(Long64_t iev = 0; iev < nev; iev++) {
+       tree->GetEntry(iev);
+       gBrOrigFilename->SetString(orig_filename->GetString());
+       gBrOrigEvtNum = orig_evtnum;
+       ntpw.AddEventRecord(iev_glob,mcrec->event);
+       iev_glob++;
+       mcrec->Clear();
+     }
+     fin.Close();
+
+     LOG("gevpick", pNOTICE) 
+        << "Merged " << nev << " events from: " << filename;
+     gSystem->Unlink(filename.c_str());
+  }
+
+  // save the cherry-picked MC events
+  ntpw.Save();
+}
+//____________________________________________________________________________________
+bool AcceptEvent(const NtpMCEventSummary & summary)
 {
   if ( gPickedTopology == kPtAll       ) return true;
   if ( gPickedTopology == kPtUndefined ) return false;
 
-  const Interaction * interaction = event.Summary();
-
-  int  nupdg     = event.Probe()->Pdg();
+  int  nupdg     = summary.neu;
   bool isnumu    = (nupdg == kPdgNuMu);
   bool isnumubar = (nupdg == kPdgAntiNuMu);
-  bool iscc      = interaction->ProcInfo().IsWeakCC();
-  bool isnc      = interaction->ProcInfo().IsWeakNC();
-
-  int NfP        = 0; // number of protons         in final state
-  int NfPbar     = 0; // number of anti-protons    in final state
-  int NfN        = 0; // number of neutrons        in final state
-  int NfNbar     = 0; // number of anti-neutrons   in final state
-  int NfPip      = 0; // number of \pi^+'s         in final state
-  int NfPim      = 0; // number of \pi^-'s         in final state
-  int NfPi0      = 0; // number of \pi^0's         in final state
-  int NfKp       = 0; // number of \K^+'s          in final state
-  int NfKm       = 0; // number of \K^-'s          in final state
-  int NfK0       = 0; // number of \K^0's          in final state
-  int NfK0bar    = 0; // number of \bar{\K^0}'s    in final state
-  int NfSigmap   = 0; // number of \Sigma^+'s      in final state
-  int NfSigma0   = 0; // number of \Sigma^0's      in final state
-  int NfSigmam   = 0; // number of \Sigma^-'s      in final state
-  int NfLambda0  = 0; // number of \Lambda^0's     in final state
-  int NfXi0      = 0; // number of \Xi^0's         in final state
-  int NfXim      = 0; // number of \Xi^-'s         in final state
-  int NfOmegam   = 0; // number of \Omega^-'s      in final state
-  int NfOther    = 0; // number of other particles in final state
-
-  TObjArrayIter piter(&event);
-  GHepParticle * p = 0;
-  int ip=-1;
-  while( (p = (GHepParticle *) piter.Next())) {
-    ip++;
-    int pdgc = p->Pdg();
-    int ist  = p->Status();
-    // only final state particles
-    if(ist!=kIStStableFinalState) continue;
-    // don't count final state lepton as part of the hadronic system
-    if(event.Particle(ip)->FirstMother()==0) continue;
-    // skip pseudo-particles
-    if(pdg::IsPseudoParticle(pdgc)) continue;
-    // count ...
-    if      (pdgc == kPdgProton     ) NfP++;
-    else if (pdgc == kPdgAntiProton ) NfPbar++;
-    else if (pdgc == kPdgNeutron    ) NfN++;
-    else if (pdgc == kPdgAntiNeutron) NfNbar++;
-    else if (pdgc == kPdgPiP        ) NfPip++;
-    else if (pdgc == kPdgPiM        ) NfPim++;
-    else if (pdgc == kPdgPi0        ) NfPi0++;
-    else if (pdgc == kPdgKP         ) NfKp++;
-    else if (pdgc == kPdgKM         ) NfKm++;
-    else if (pdgc == kPdgK0         ) NfK0++;
-    else if (pdgc == kPdgAntiK0     ) NfK0bar++;
-    else if (pdgc == kPdgSigmaP     ) NfSigmap++;
-    else if (pdgc == kPdgSigma0     ) NfSigma0++;
-    else if (pdgc == kPdgSigmaM     ) NfSigmam++;
-    else if (pdgc == kPdgLambda     ) NfLambda0++;
-    else if (pdgc == kPdgXi0        ) NfXi0++;
-    else if (pdgc == kPdgXiM        ) NfXim++;
-    else if (pdgc == kPdgOmegaM     ) NfOmegam++;
-    else                              NfOther++;
-  }
+  bool iscc      = summary.cc;
+  bool isnc      = summary.nc;
+
+  int NfPip      = summary.nfpip;  // number of \pi^+'s         in final state
+  int NfPim      = summary.nfpim;  // number of \pi^-'s         in final state
+  int NfPi0      = summary.nfpi0;  // number of \pi^0's         in final state
+  int NfSigmap   = summary.nfsigp; // number of \Sigma^+'s      in final state
+  int NfSigma0   = summary.nfsig0; // number of \Sigma^0's      in final state
+  int NfSigmam   = summary.nfsigm; // number of \Sigma^-'s      in final state
+  int NfLambda0  = summary.nflam;  // number of \Lambda^0's     in final state
+  int NfXi0      = summary.nfxi0;  // number of \Xi^0's         in final state
+  int NfXim      = summary.nfxim;  // number of \Xi^-'s         in final state
+  int NfOmegam   = summary.nfomm;  // number of \Omega^-'s      in final state
 
   bool is1pipX  = (NfPip==1 && NfPi0==0 && NfPim==0);
   bool is1pi0X  = (NfPip==0 && NfPi0==1 && NfPim==0);
@@ -438,12 +502,27 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptOutFileName = DefaultOutputFile();
   }
 
+  // number of worker processes
+  if( parser.OptionExists("workers") ) {
+    gOptNWorkers = parser.ArgAsInt("workers");
+    if(gOptNWorkers < 1) {
+      LOG("gevpick", pFATAL) << "Invalid number of workers: " << gOptNWorkers;
+      gAbortingInErr = true;
+      exit(1);
+    }
+  } else {
+    LOG("gevpick", pINFO)
+       << "Unspecified number of workers - Using default";
+    gOptNWorkers = 1;
+  }
+
   // Summarize
   LOG("gevpick", pNOTICE) 
     << "\n\n gevpick job info: "
     << "\n - input file(s)          : " << gOptInpFileNames
     << "\n - output file            : " << gOptOutFileName
     << "\n - cherry-picked topology : " << topo
+    << "\n - number of workers      : " << gOptNWorkers
     << "\n";
 }
 //____________________________________________________________________________________
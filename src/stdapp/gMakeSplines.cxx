@@ -13,9 +13,12 @@
            gmkspl -p nupdg <-t target_pdg_codes, -f geometry_file> 
                   <-o | --output-cross-sections> output_xml_xsec_file
                   [-n nknots] [-e max_energy] [--seed random_number_seed] 
+                  [--knot-tolerance tolerance]
                   [--input-cross-sections xml_file]
                   [--event-generator-list list_name]
                   [--message-thresholds xml_file]
+                  [--workers n] [--resume]
+                  [--cache-file root_file]
 
          Note :
            [] marks optional arguments.
@@ -41,6 +44,14 @@
                Maximum energy in spline.
                Default: The max energy in the validity range of the spline 
                generating thread.
+           --knot-tolerance
+               Switch on adaptive knot placement: Starting from a coarse
+               grid, intervals are bisected until the spline reproduces
+               the computed cross section at the interval mid-point within
+               the given relative tolerance (eg 0.005).
+               The number of knots set with -n is then used as the maximum
+               number of knots per spline.
+               Default: 0 (fixed knot placement).
            --seed
               Random number seed.
            --input-cross-sections
@@ -54,6 +65,38 @@
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
               See $GENIE/config/Messenger.xml for the XML schema.
+           --workers
+              Number of processes building splines in parallel.
+              The splines requested for all the input initial states are
+              assigned to the workers from a hash of their key. Each worker
+              writes the splines it built in a checkpoint file (`output.w<id>',
+              in the binary spline archive format) after every initial state.
+              Once all workers are done, their files are merged (in worker
+              order) and removed.
+              With more than one worker and nuclear targets, splines are 
+              built in two passes: The free-nucleon splines (which are used
+              in the cross-section calculation for nuclear targets) are built
+              and merged first, and are then available to every worker 
+              building nuclear splines. The free-nucleon splines are then 
+              always included in the output. The output does not depend on 
+              the number of workers, and is the same as the output of a 
+              single process run with the free nucleons listed first in the
+              target list.
+              Default: 1 (no parallel processes).
+           --resume
+              Resume an interrupted job: All splines found in the output
+              file and in the worker checkpoint files left behind by an
+              earlier run (with any number of workers) are loaded and are
+              not rebuilt.
+           --cache-file
+              Once the splines are built, also pre-compute the maximum
+              differential cross sections used by the kinematics generators
+              (on the same energy grid as the splines) and store them in 
+              the specified cache file. Event generation jobs using the same
+              cache file (and the same physics configuration) do not need to
+              compute them at the start of each job. The job fails if 
+              too few values can be cached for an interaction to build the
+              spline interpolated at event generation.
 
         ***  See the User Manual for more details and examples. ***
 
@@ -74,13 +117,17 @@
 #include <string>
 #include <vector>
 
+#include <sstream>
+
 #include <TSystem.h>
 
 #include "Conventions/GBuild.h"
 #include "EVGDrivers/GEVGDriver.h"
+#include "EVGDrivers/GMCJWorkerPool.h"
 #include "Interaction/Interaction.h"
 #include "Messenger/Messenger.h"
 #include "Numerical/RandomGen.h"
+#include "PDG/PDGCodes.h"
 #include "PDG/PDGCodeList.h"
 #include "Utils/RunOpt.h"
 #include "Utils/AppInit.h"
@@ -94,6 +141,7 @@
 #include "Geo/ROOTGeomAnalyzer.h"
 #endif
 
+using std::ostringstream;
 using std::string;
 using std::vector;
 
@@ -108,6 +156,13 @@ void          GetCommandLineArgs (int argc, char ** argv);
 void          PrintSyntax        (void);
 PDGCodeList * GetNeutrinoCodes   (void);
 PDGCodeList * GetTargetCodes     (void);
+string        CheckpointFilename (int iworker);
+void          LoadCheckpoints    (void);
+void          MergeCheckpoints   (const GMCJWorkerPool & workers);
+bool          BuildSplines       (const PDGCodeList * neutrinos, const PDGCodeList * targets);
+void          RemoveCheckpoints  (void);
+void          BuildMaxXSecCache  (const PDGCodeList * neutrinos, const PDGCodeList * targets);
+void          FinishJob          (PDGCodeList * neutrinos, PDGCodeList * targets);
 
 // User-specified options:
 string   gOptNuPdgCodeList  = "";
@@ -115,9 +170,12 @@ string   gOptTgtPdgCodeList = "";
 string   gOptGeomFilename   = "";
 int      gOptNKnots         = -1;
 double   gOptMaxE           = -1.;
+double   gOptKnotTol        = 0.;   // adaptive knot placement tolerance
 long int gOptRanSeed        = -1;   // random number seed
 string   gOptInpXSecFile    = "";   // input cross-section file
 string   gOptOutXSecFile    = "";   // output cross-section file
+int      gOptNWorkers       = 1;    // number of spline building processes
+bool     gOptResume         = false;// resume an interrupted job?
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -149,32 +207,71 @@ int main(int argc, char ** argv)
   LOG("gmkspl", pINFO) << "Neutrinos: " << *neutrinos;
   LOG("gmkspl", pINFO) << "Targets: "   << *targets;
 
-  // Loop over all possible input init states and ask the GEVGDriver
-  // to build splines for all the interactions that its loaded list
-  // of event generators can generate.
+  XSecSplineList * xspl = XSecSplineList::Instance();
+  xspl->SetKnotTolerance(gOptKnotTol);
 
-  PDGCodeList::const_iterator nuiter;
+  // Pick-up the splines built by an interrupted job
+  if(gOptResume) LoadCheckpoints();
+
+  // A single process builds the splines in the order requested
+  if(gOptNWorkers <= 1) {
+    BuildSplines(neutrinos, targets);
+    FinishJob(neutrinos, targets);
+    return 0;
+  }
+
+  // Nuclear cross section calculations use the free-nucleon splines, if
+  // available. With parallel workers, all free-nucleon splines are built 
+  // first, so that the nuclear splines do not depend on which free-nucleon
+  // splines were built by the same worker.
+
+  PDGCodeList nucleons;
+  PDGCodeList nuclei;
   PDGCodeList::const_iterator tgtiter;
-  for(nuiter = neutrinos->begin(); nuiter != neutrinos->end(); ++nuiter) {
-    for(tgtiter = targets->begin(); tgtiter != targets->end(); ++tgtiter) {
-      int nupdgc  = *nuiter;
-      int tgtpdgc = *tgtiter;
-      InitialState init_state(tgtpdgc, nupdgc);
-      GEVGDriver driver;
-      driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
-      driver.Configure(init_state);
-      driver.CreateSplines(gOptNKnots, gOptMaxE);
+  for(tgtiter = targets->begin(); tgtiter != targets->end(); ++tgtiter) {
+    int tgtpdgc = *tgtiter;
+    if(tgtpdgc == kPdgTgtFreeP || tgtpdgc == kPdgTgtFreeN) {
+      nucleons.push_back(tgtpdgc);
+    } else {
+      nuclei.push_back(tgtpdgc);
     }
   }
+  if(nuclei.size() > 0) {
+    if(!nucleons.ExistsInPDGCodeList(kPdgTgtFreeP)) nucleons.push_back(kPdgTgtFreeP);
+    if(!nucleons.ExistsInPDGCodeList(kPdgTgtFreeN)) nucleons.push_back(kPdgTgtFreeN);
+  }
+
+  bool is_worker = BuildSplines(neutrinos, &nucleons);
+  if(!is_worker && nuclei.size() > 0) {
+    is_worker = BuildSplines(neutrinos, &nuclei);
+  }
+
+  // Parallel workers are done: the master merges their checkpoint files
+  if(is_worker) {
+    delete neutrinos;
+    delete targets;
+    return 0;
+  }
+
+  FinishJob(neutrinos, targets);
 
-  // Save the splines at the requested XML file
+  return 0;
+}
+//____________________________________________________________________________
+void FinishJob(PDGCodeList * neutrinos, PDGCodeList * targets)
+{
+  // Save the splines at the requested XML file & clean-up the checkpoints
   XSecSplineList * xspl = XSecSplineList::Instance();
   xspl->SaveAsXml(gOptOutXSecFile);
+  RemoveCheckpoints();
+
+  // Pre-compute the max differential cross sections, if requested
+  if(RunOpt::Instance()->CacheFile().size() > 0) {
+    BuildMaxXSecCache(neutrinos, targets);
+  }
 
   delete neutrinos;
   delete targets;
-
-  return 0;
 }
 //____________________________________________________________________________
 void GetCommandLineArgs(int argc, char ** argv)
@@ -225,6 +322,16 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptMaxE = -1;
   }
 
+  // adaptive knot placement tolerance
+  if( parser.OptionExists("knot-tolerance") ) {
+    LOG("gmkspl", pINFO) << "Reading adaptive knot placement tolerance";
+    gOptKnotTol = parser.ArgAsDouble("knot-tolerance");
+  } else {
+    LOG("gmkspl", pINFO) 
+       << "Unspecified knot placement tolerance - Using fixed knots";
+    gOptKnotTol = 0.;
+  }
+
   // comma-separated neutrino PDG code list
   if( parser.OptionExists('p') ) {
     LOG("gmkspl", pINFO) << "Reading neutrino PDG codes";
@@ -289,6 +396,23 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  // number of spline building processes
+  if( parser.OptionExists("workers") ) {
+    LOG("gmkspl", pINFO) << "Reading number of workers";
+    gOptNWorkers = parser.ArgAsInt("workers");
+    if(gOptNWorkers < 1) {
+      LOG("gmkspl", pFATAL) << "Invalid number of workers: " << gOptNWorkers;
+      PrintSyntax();
+      exit(1);
+    }
+  } else {
+    LOG("gmkspl", pINFO) << "Unspecified number of workers - Using default";
+    gOptNWorkers = 1;
+  }
+
+  // resume an interrupted job?
+  gOptResume = parser.OptionExists("resume");
+
   //
   // print the command-line options 
   //
@@ -301,6 +425,9 @@ void GetCommandLineArgs(int argc, char ** argv)
      << "\n Output cross-section file : " << gOptOutXSecFile
      << "\n Input cross-section file : " << gOptInpXSecFile
      << "\n Random number seed : " << gOptRanSeed
+     << "\n Knot placement tolerance : " << gOptKnotTol
+     << "\n Number of workers : " << gOptNWorkers
+     << "\n Resume interrupted job : " << utils::print::BoolAsYNString(gOptResume)
      << "\n";
 
   LOG("gmkspl", pNOTICE) << *RunOpt::Instance();
@@ -313,10 +440,13 @@ void PrintSyntax(void)
     << "   gmkspl -p nupdg <-t tgtpdg, -f geomfile> "
     << " <-o | --output-cross-section> xsec_xml_file_name"
     << " [-n nknots] [-e max_energy] "
+    << " [--knot-tolerance tolerance]"
     << " [--seed seed_number]"
     << " [--input-cross-section xml_file]"
     << " [--event-generator-list list_name]"
-    << " [--message-thresholds xml_file]\n\n";
+    << " [--message-thresholds xml_file]"
+    << " [--workers n] [--resume]"
+    << " [--cache-file root_file]\n\n";
 }
 //____________________________________________________________________________
 PDGCodeList * GetNeutrinoCodes(void)
@@ -373,4 +503,133 @@ PDGCodeList * GetTargetCodes(void)
   return 0;
 }
 //____________________________________________________________________________
+bool BuildSplines(const PDGCodeList * neutrinos, const PDGCodeList * targets)
+{
+// Build the splines for all input initial states.
+// Forks the spline building workers (if more than one was requested).
+// Every worker goes through the same sequence of spline requests and builds
+// its own share of it. Once the workers are done, the master merges their
+// checkpoint files. Returns true in parallel workers.
+
+  XSecSplineList * xspl = XSecSplineList::Instance();
+
+  GMCJWorkerPool workers(gOptNWorkers);
+  int iworker = workers.Fork();
+
+  if(workers.IsMaster()) {
+    MergeCheckpoints(workers);
+    return false;
+  }
+
+  xspl->SetWorkShare(iworker, workers.NWorkers());
+
+  // Loop over all possible input init states and ask the GEVGDriver
+  // to build splines for all the interactions that its loaded list
+  // of event generators can generate.
+
+  PDGCodeList::const_iterator nuiter;
+  PDGCodeList::const_iterator tgtiter;
+  for(nuiter = neutrinos->begin(); nuiter != neutrinos->end(); ++nuiter) {
+    for(tgtiter = targets->begin(); tgtiter != targets->end(); ++tgtiter) {
+      int nupdgc  = *nuiter;
+      int tgtpdgc = *tgtiter;
+      InitialState init_state(tgtpdgc, nupdgc);
+      GEVGDriver driver;
+      driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+      driver.Configure(init_state);
+      driver.CreateSplines(gOptNKnots, gOptMaxE);
+
+      // checkpoint, so that an interrupted job can be resumed
+      xspl->SaveAsBinary(CheckpointFilename(iworker));
+    }
+  }
+
+  return workers.IsParallel();
+}
+//____________________________________________________________________________
+string CheckpointFilename(int iworker)
+{
+  ostringstream filename;
+  filename << gOptOutXSecFile << ".w" << iworker;
+  return filename.str();
+}
+//____________________________________________________________________________
+void LoadCheckpoints(void)
+{
+// Load the output file and all worker checkpoint files of an interrupted
+// job (the number of workers may have been different)
+
+  XSecSplineList * xspl = XSecSplineList::Instance();
 
+  if( ! gSystem->AccessPathName(gOptOutXSecFile.c_str()) ) {
+    LOG("gmkspl", pNOTICE) << "Resuming from: " << gOptOutXSecFile;
+    xspl->LoadFromFile(gOptOutXSecFile, true);
+  }
+  for(int iw = 0; ; iw++) {
+    string filename = CheckpointFilename(iw);
+    if( gSystem->AccessPathName(filename.c_str()) ) break;
+    LOG("gmkspl", pNOTICE) << "Resuming from: " << filename;
+    xspl->LoadFromFile(filename, true);
+  }
+}
+//____________________________________________________________________________
+void MergeCheckpoints(const GMCJWorkerPool & workers)
+{
+  XSecSplineList * xspl = XSecSplineList::Instance();
+
+  for(int iw = 0; iw < workers.NWorkers(); iw++) {
+    string filename = CheckpointFilename(iw);
+    if( gSystem->AccessPathName(filename.c_str()) ) {
+      LOG("gmkspl", pWARN)
+        << "Worker " << iw << " left no splines in: " << filename;
+      continue;
+    }
+    LOG("gmkspl", pNOTICE) << "Merging splines from: " << filename;
+    XmlParserStatus_t status = xspl->LoadFromBinary(filename, true);
+    if(status != kXmlOK) {
+      LOG("gmkspl", pFATAL) << "Could not merge splines from: " << filename;
+      gAbortingInErr = true;
+      exit(1);
+    }
+  }
+}
+//____________________________________________________________________________
+void RemoveCheckpoints(void)
+{
+  for(int iw = 0; ; iw++) {
+    string filename = CheckpointFilename(iw);
+    if( gSystem->AccessPathName(filename.c_str()) ) break;
+    gSystem->Unlink(filename.c_str());
+  }
+}
+//____________________________________________________________________________
+void BuildMaxXSecCache(
+    const PDGCodeList * neutrinos, const PDGCodeList * targets)
+{
+// Pre-compute the max differential cross sections used by the kinematics
+// generators for all input init states. They are saved in the cache file
+// at the end of the job.
+
+  utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+
+  PDGCodeList::const_iterator nuiter;
+  PDGCodeList::const_iterator tgtiter;
+  for(nuiter = neutrinos->begin(); nuiter != neutrinos->end(); ++nuiter) {
+    for(tgtiter = targets->begin(); tgtiter != targets->end(); ++tgtiter) {
+      int nupdgc  = *nuiter;
+      int tgtpdgc = *tgtiter;
+      InitialState init_state(tgtpdgc, nupdgc);
+      GEVGDriver driver;
+      driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+      driver.Configure(init_state);
+      if(!driver.CreateMaxXSecCache(gOptNKnots, gOptMaxE)) {
+        LOG("gmkspl", pFATAL) 
+          << "Failed to pre-compute the max differential cross sections for "
+          << init_state.AsString();
+        gAbortingInErr = true;
+        exit(1);
+      }
+    }
+  }
+}
+//____________________________________________________________________________
@@ -20,7 +20,8 @@
          Syntax :
            gmxpl -f geom_file [-L length_units] [-D density_units] 
                  [-t top_vol_name] [-o output_xml_file] [-n np] [-r nr]
-                 [-seed random_number_seed]
+                 [-seed random_number_seed] [--workers n]
+                 [--tolerance tol] [--refine-rays nr]
                  [--message-thresholds xml_file]
 
          Options :
@@ -40,6 +41,24 @@
                Name of output XML file [ default: maxpl.xml ]
            --seed 
                Random number seed.
+           --workers
+               Number of parallel worker processes [ default: 1 ].
+               The scanning points of each box surface are shared out 
+               between the workers. Each worker traces its rays through its
+               own copy of the geometry and uses its own random number seed
+               (seed + worker id). The master saves the largest path length
+               found by any worker for each material.
+           --tolerance
+               Relative tolerance for refining the max path lengths 
+               [ default: 0, no refinement ].
+               After the box scan, rays are thrown around the ray giving the
+               current max path length for each material, with a smearing
+               that is reduced as the max path lengths converge. Iterations
+               stop once the max path lengths change by less than the 
+               tolerance at the smallest smearing.
+           --refine-rays
+               Number of refinement rays / material / iteration 
+               [ default: see geom driver's defaults ]
           --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
@@ -73,7 +92,9 @@
 #include <string>
 
 #include <TMath.h>
+#include <TSystem.h>
 
+#include "EVGDrivers/GMCJWorkerPool.h"
 #include "EVGDrivers/PathLengthList.h"
 #include "Geo/ROOTGeomAnalyzer.h"
 #include "Messenger/Messenger.h"
@@ -92,6 +113,7 @@ using namespace genie::geometry;
 // Prototypes:
 void GetCommandLineArgs (int argc, char ** argv);
 void PrintSyntax        (void);
+void MergeWorkerOutputs (const GMCJWorkerPool & workers);
 
 // Defaults for optional options:
 string kDefOptXMLFilename  = "maxpl.xml"; // default output xml filename
@@ -107,6 +129,9 @@ double    gOptGeomDUnits      = 0;           // input geometry density units
 int       gOptNPoints         = -1;          // input number of points / surf
 int       gOptNRays           = -1;          // input number of rays / point
 long int  gOptRanSeed         = -1;          // random number seed
+int       gOptNWorkers        = 1;           // number of worker processes
+double    gOptTolerance       = 0;           // max path length refinement tolerance
+int       gOptNRefineRays     = -1;          // refinement rays / material / iteration
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -129,8 +154,24 @@ int main(int argc, char ** argv)
   geom -> SetTopVolName        (gOptRootGeomTopVol);
   geom -> SetWeightWithDensity (true);
 
-  if(gOptNPoints > 0) geom->SetScannerNPoints(gOptNPoints);
-  if(gOptNRays   > 0) geom->SetScannerNRays  (gOptNRays);
+  if(gOptNPoints     > 0) geom->SetScannerNPoints    (gOptNPoints);
+  if(gOptNRays       > 0) geom->SetScannerNRays      (gOptNRays);
+  if(gOptNRefineRays > 0) geom->SetScannerNRefineRays(gOptNRefineRays);
+  geom->SetScannerTolerance(gOptTolerance);
+
+  // Fork the workers (if more than one was requested). 
+  // Each one scans its share of points on each box surface.
+  GMCJWorkerPool workers(gOptNWorkers);
+  int iworker = workers.Fork();
+
+  if(workers.IsMaster()) {
+    MergeWorkerOutputs(workers);
+    delete geom;
+    return 0;
+  }
+
+  int npoints = workers.NEvents(geom->ScannerNPoints());
+  geom->SetScannerNPoints(TMath::Max(npoints,1));
 
   // Compute the maximum path lengths
   LOG("gmxpl", pINFO)
@@ -140,13 +181,49 @@ int main(int argc, char ** argv)
   // Print & save the maximum path lengths in XML format
   LOG("gmxpl", pINFO)
       << "Maximum path lengths: " << plmax;
-  plmax.SaveAsXml(gOptXMLFilename);
+  plmax.SaveAsXml(workers.WorkerFilenamePrefix(gOptXMLFilename,iworker));
 
   delete geom;
 
   return 0;
 }
 //____________________________________________________________________________
+void MergeWorkerOutputs(const GMCJWorkerPool & workers)
+{
+// Save the largest max path length found by any worker for each material
+
+  PathLengthList plmax;
+
+  for(int iw = 0; iw < workers.NWorkers(); iw++) {
+    string filename = workers.WorkerFilenamePrefix(gOptXMLFilename, iw);
+    PathLengthList pl;
+    XmlParserStatus_t status = pl.LoadFromXml(filename);
+    if(status != kXmlOK) {
+      LOG("gmxpl", pFATAL) 
+        << "Could not read the max path lengths of worker " << iw 
+        << " from: " << filename;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    PathLengthList::const_iterator pl_iter;
+    for(pl_iter = pl.begin(); pl_iter != pl.end(); ++pl_iter) {
+      int    pdgc   = pl_iter->first;
+      double length = pl_iter->second;
+      PathLengthList::iterator max_iter = plmax.find(pdgc);
+      if(max_iter == plmax.end()) {
+        plmax.insert(map<int,double>::value_type(pdgc, length));
+      } else {
+        max_iter->second = TMath::Max(length, max_iter->second);
+      }
+    }
+    gSystem->Unlink(filename.c_str());
+  }
+
+  LOG("gmxpl", pINFO)
+      << "Maximum path lengths: " << plmax;
+  plmax.SaveAsXml(gOptXMLFilename);
+}
+//____________________________________________________________________________
 void GetCommandLineArgs(int argc, char ** argv)
 {
   LOG("gmxpl", pINFO) << "Parsing command line arguments";
@@ -239,6 +316,38 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptRanSeed = -1;
   }
 
+  // number of worker processes
+  if( parser.OptionExists("workers") ) {
+    LOG("gmxpl", pINFO) << "Reading number of workers";
+    gOptNWorkers = parser.ArgAsInt("workers");
+    if(gOptNWorkers < 1) {
+      LOG("gmxpl", pFATAL) << "Invalid number of workers: " << gOptNWorkers;
+      PrintSyntax();
+      exit(1);
+    }
+  } else {
+    LOG("gmxpl", pINFO) << "Unspecified number of workers - Using default";
+    gOptNWorkers = 1;
+  }
+
+  // max path length refinement tolerance
+  if( parser.OptionExists("tolerance") ) {
+    LOG("gmxpl", pINFO) << "Reading max path length refinement tolerance";
+    gOptTolerance = parser.ArgAsDouble("tolerance");
+  } else {
+    LOG("gmxpl", pINFO) << "Unspecified refinement tolerance - No refinement";
+    gOptTolerance = 0;
+  }
+
+  // number of refinement rays / material / iteration
+  if( parser.OptionExists("refine-rays") ) {
+    LOG("gmxpl", pINFO) << "Reading number of refinement rays";
+    gOptNRefineRays = parser.ArgAsInt("refine-rays");
+  } else {
+    LOG("gmxpl", pINFO)
+      << "Unspecified number of refinement rays - Using driver's default";
+  }
+
   // print the command line arguments
   LOG("gmxpl", pNOTICE)
      << "\n"
@@ -251,6 +360,9 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gmxpl", pNOTICE) << "Scanner points/surface  : " << gOptNPoints;
   LOG("gmxpl", pNOTICE) << "Scanner rays/point      : " << gOptNRays;
   LOG("gmxpl", pNOTICE) << "Random number seed      : " << gOptRanSeed;
+  LOG("gmxpl", pNOTICE) << "Number of workers       : " << gOptNWorkers;
+  LOG("gmxpl", pNOTICE) << "Refinement tolerance    : " << gOptTolerance;
+  LOG("gmxpl", pNOTICE) << "Refinement rays         : " << gOptNRefineRays;
 
   LOG("gmxpl", pNOTICE) << "\n";
   LOG("gmxpl", pNOTICE) << *RunOpt::Instance();
@@ -267,6 +379,9 @@ void PrintSyntax(void)
       << " [-t top_volume_name]"
       << " [-o output_xml_file]"
       << " [-seed random_number_seed]"
+      << " [--workers n]"
+      << " [--tolerance tol]"
+      << " [--refine-rays nr]"
       << " [--message-thresholds xml_file]\n";
 
 }
@@ -7,24 +7,30 @@
 
          Syntax :
            gspladd -f file_list -d directory_list -o output.xml
+                   [--binary]
                    [--message-thresholds xml_file]
 
          Options :
            -f 
-              A list of input xml cross-section files. If more than one then 
-              separate using commas.
+              A list of input xml cross-section files (or binary spline
+              archives). If more than one then separate using commas.
            -d 
               A list of input directories where to look for xml cross section
               files. If more than one then separate using commas.
            -o 
               output xml file
+           --binary
+              Write the output as a binary spline archive rather than as an
+              XML file. Binary archives are loaded much faster by all GENIE
+              applications reading cross section files.
            --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
               See $GENIE/config/Messenger.xml for the XML schema.
 
          Notes :
-           There must be at least 2 files for the merges to work
+           A single input file can be given in order to convert it from XML
+           to a binary spline archive (or vice versa)
 
          Examples :
 
@@ -39,6 +45,10 @@
               can be found in the /path and /other_path directories and write-out
               a single file named xsec_all.xml
 
+           3) shell% gspladd -f xsec.xml -o xsec.gspl --binary
+
+              will convert xsec.xml into a binary spline archive
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          Rutherford Appleton Laboratory
 
@@ -79,6 +89,7 @@ void           PrintSyntax        (void);
 
 //User-specified options:
 string         gOutFile;   ///< output XML file
+bool           gBinary;    ///< write-out a binary spline archive?
 vector<string> gInpFiles;  ///< list of input XML files
 vector<string> gInpDirs;   ///< list of input dirs (to look for XML files)
 vector<string> gAllFiles;  ///< list of all input files
@@ -96,13 +107,14 @@ int main(int argc, char ** argv)
   for( ; file_iter != gAllFiles.end(); ++file_iter) {
     string filename = *file_iter;
     LOG("gspladd", pNOTICE) << " ---- >> Loading file : " << filename;
-    XmlParserStatus_t ist = xspl->LoadFromXml(filename, true);
+    XmlParserStatus_t ist = xspl->LoadFromFile(filename, true);
     assert(ist==kXmlOK);
   }
 
   LOG("gspladd", pNOTICE) 
      << " ****** Saving all loaded splines into : " << gOutFile;
-  xspl->SaveAsXml(gOutFile);
+  if(gBinary) xspl->SaveAsBinary(gOutFile);
+  else        xspl->SaveAsXml   (gOutFile);
 
   return 0;
 }
@@ -182,9 +194,11 @@ void GetCommandLineArgs(int argc, char ** argv)
     exit(1);
   }
 
+  gBinary = parser.OptionExists("binary");
+
   gAllFiles = GetAllInputFiles();
-  if(gAllFiles.size() <= 1) {
-    LOG("gspladd", pFATAL) << "There must be at least 2 input files";
+  if(gAllFiles.size() < 1) {
+    LOG("gspladd", pFATAL) << "There must be at least 1 input file";
     PrintSyntax();
     exit(1);
   }
@@ -195,6 +209,7 @@ void PrintSyntax(void)
   LOG("gspladd", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
     << "   gspladd  -f file_list -d directory_list  -o output.xml\n"
+    << "            [--binary]\n"
     << "            [--message-thresholds xml_file]\n";
 
 }
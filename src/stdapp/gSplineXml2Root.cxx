@@ -16,7 +16,8 @@
            []  denotes an optional argument
 
            -f  
-              the input XML file containing the cross section spline data
+              the input XML file (or binary spline archive, see gspladd)
+              containing the cross section spline data
            -p  
               the neutrino pdg code
            -t  
@@ -179,7 +180,7 @@ void LoadSplines(void)
 // load the cross section splines specified at the cmd line
 
   XSecSplineList * splist = XSecSplineList::Instance();
-  XmlParserStatus_t ist = splist->LoadFromXml(gOptXMLFilename);
+  XmlParserStatus_t ist = splist->LoadFromFile(gOptXMLFilename);
   assert(ist == kXmlOK);
 }
 //____________________________________________________________________________
@@ -9,6 +9,9 @@
          input event. Each such tree entry contains a TArrayF of all computed 
          weights and a TArrayF of all used tweak dial values. 
          Is a RAL/T2K analysis program.
+         The input events are read only once: events are processed in
+         blocks and each block is reweighted for all tweak dial values
+         (see GReWeight::CalcWeights()).
 
 \syntax  grwght1scan \
            -f input_event_file 
@@ -75,6 +78,7 @@
 
 #include <string>
 #include <sstream>
+#include <vector>
 #include <cassert>
 
 #include <TSystem.h>
@@ -115,6 +119,7 @@
 
 using std::string;
 using std::ostringstream;
+using std::vector;
 
 using namespace genie;
 using namespace genie::rew;
@@ -132,6 +137,8 @@ int         gOptInpNTwk;     ///< # of tweaking dial values between [-1,1]
 PDGCodeList gOptNu(false);   ///< neutrinos to consider
 long int    gOptRanSeed;    ///< random number seed
 
+const int   kNEvBlock = 10000; ///< number of events reweighted in a single pass
+
 //___________________________________________________________________
 int main(int argc, char ** argv)
 {
@@ -253,55 +260,68 @@ int main(int argc, char ** argv)
      rwdis->SetMode(GReWeightNuXSecDIS::kModeABCV12uShape);
   }
 
-  // Twk dial loop
+  // Set of tweaking dial values
+  vector<GDialPoint_t> dial_points(n_points);
   for(int ith_dial = 0; ith_dial < n_points; ith_dial++){  
-
-     // Set non-default values and re-configure.    
      double twk_dial = twk_dial_min + ith_dial * twk_dial_step;  
-     LOG("grwght1scan", pNOTICE) 
-       << "\n\nReconfiguring systematic: " << GSyst::AsString(gOptSyst)
-       << " - Setting tweaking dial to: " << twk_dial;
-     syst.Set(gOptSyst, twk_dial);
-     rw.Reconfigure();
-
-     // Event loop
-     for(int iev = nfirst; iev <= nlast; iev++) {
-
-          if(iev%100 == 0) {
-              LOG("grwght1scan", pNOTICE) 
-                 << "***** Currently at event number: "<< iev;
-          }
-
-          // Get next event
-          tree->GetEntry(iev);
-          EventRecord & event = *(mcrec->event);
-          LOG("grwght1scan", pINFO) << "Event: " << iev << "\n" << event;
-
-          // Reset arrays
-          int idx = iev - nfirst;
-          weights  [idx][ith_dial] = -99999.0;
-          twkdials [idx][ith_dial] = twk_dial;
-
-          // Reweight this event?
-          int nupdg = event.Probe()->Pdg();
-          bool do_reweight = gOptNu.ExistsInPDGCodeList(nupdg);
-
-          // Calculate weight
-          double wght=1.;
-          if(do_reweight) {
-	     wght = rw.CalcWeight(event);
-          }
-
-          // Print/store
-          LOG("grwght1scan", pDEBUG) 
-              << "Overall weight = " << wght;
-          weights[idx][ith_dial] = wght;
-
-          // Clean-up
-          mcrec->Clear();
-
-      } // evt loop
-  } // twk_dial loop
+     dial_points[ith_dial][gOptSyst] = twk_dial;
+  }
+
+  // Event loop
+  // Events are read once, in blocks of kNEvBlock, and each block is
+  // reweighted for all tweaking dial values in a single pass
+  vector<const EventRecord *> block;
+  vector<int>                 block_idx;
+  vector< vector<double> >    block_weights;
+
+  for(Long64_t iev = nfirst; iev <= nlast; iev++) {
+
+     if(iev%100 == 0) {
+         LOG("grwght1scan", pNOTICE) 
+            << "***** Currently at event number: "<< iev;
+     }
+
+     // Get next event
+     tree->GetEntry(iev);
+     EventRecord & event = *(mcrec->event);
+     LOG("grwght1scan", pINFO) << "Event: " << iev << "\n" << event;
+
+     // Reset arrays
+     int idx = iev - nfirst;
+     for(int ith_dial = 0; ith_dial < n_points; ith_dial++){  
+        weights  [idx][ith_dial] = 1.0;
+        twkdials [idx][ith_dial] = dial_points[ith_dial][gOptSyst];
+     }
+
+     // Reweight this event?
+     int nupdg = event.Probe()->Pdg();
+     bool do_reweight = gOptNu.ExistsInPDGCodeList(nupdg);
+     if(do_reweight) {
+        block.push_back(new EventRecord(event));
+        block_idx.push_back(idx);
+     }
+
+     // Clean-up
+     mcrec->Clear();
+
+     // Calculate weights for all events in the current block
+     bool last = (iev == nlast);
+     if((int)block.size() < kNEvBlock && !last) continue;
+
+     rw.CalcWeights(block, dial_points, block_weights);
+
+     for(unsigned int ib = 0; ib < block.size(); ib++) {
+        for(int ith_dial = 0; ith_dial < n_points; ith_dial++){  
+           LOG("grwght1scan", pDEBUG) 
+              << "Overall weight = " << block_weights[ib][ith_dial];
+           weights[block_idx[ib]][ith_dial] = block_weights[ib][ith_dial];
+        }
+        delete block[ib];
+     }
+     block.clear();
+     block_idx.clear();
+
+  } // evt loop
 
   // Close event file
   file.Close();
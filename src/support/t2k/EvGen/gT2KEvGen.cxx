@@ -24,6 +24,8 @@
                       [-t top_volume_name_at_geom || -t +Vol1-Vol2...] 
                       [-P pre_gen_prob_file_name] 
                       [-S] [output_name]
+                      [--flux-prob-workers n]
+                      [--extend-flux-probs]
                       [-m max_path_lengths_xml_file]
                       [-L length_units_at_geom] 
                       [-D density_units_at_geom]
@@ -119,6 +121,19 @@
               Introducing multiple functionality to the executable is not 
               desirable but is less error prone than duplicating a lot of the
               functionality in a separate application. 
+           --flux-prob-workers
+              Number of processes used for calculating the flux interaction
+              probabilities (-S option or when -P is not used) [default: 1].
+              The flux entries are interleaved between the processes (process
+              i handles the entries whose index modulo n equals i) and the
+              results are merged in flux entry order, so the output does not
+              depend on the number of processes.
+           --extend-flux-probs
+              Used with -P, when the flux file contains more entries than the
+              pre-calculated interaction probabilities file: the missing
+              entries are calculated and added to the loaded ones. Can be
+              combined with -S to save the extended set to a new file (which
+              must differ from the -P input file).
 	   -m 
               An XML file (generated by gmxpl) with the max (density weighted) 
               path-lengths for each target material in the input ROOT geometry.              
@@ -500,6 +515,8 @@ bool            gOptUseFluxProbs = false;      // use pre-calculated flux intera
 bool            gOptSaveFluxProbsFile = false; // special mode: no events generated, calculate and save flux interaction probs to root file 
 string          gOptFluxProbFileName;          // filename for file containg flux probs 
 string          gOptSaveFluxProbsFileName;     // output filename for pre-generated flux probabilities
+int             gOptNFluxProbWorkers = 1;      // number of processes used for calculating flux interaction probs
+bool            gOptExtendFluxProbs = false;   // calculate flux interaction probs missing from the pre-calculated file
 bool            gOptRandomFluxOffset = false;  // start looping over flux file from random start entry
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
@@ -671,9 +688,14 @@ int main(int argc, char ** argv)
       mcj_driver->SaveFluxProbabilities(name);
     }
 
-    // Either load pre-generated flux probabilities
+    // number of processes used for calculating flux interaction probs
+    mcj_driver->SetNFluxProbWorkers(gOptNFluxProbWorkers);
+
+    // Either load pre-generated flux probabilities (calculating any missing
+    // ones if requested)
     if(gOptFluxProbFileName.size() > 0){ 
-      success = mcj_driver->LoadFluxProbabilities(gOptFluxProbFileName);
+      success = mcj_driver->LoadFluxProbabilities(
+                   gOptFluxProbFileName, gOptExtendFluxProbs);
     }
     // Or pre-calculate them 
     else success = mcj_driver->PreCalcFluxProbabilities();
@@ -1224,12 +1246,43 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptSaveFluxProbsFileName = parser.ArgAsString('S');
   }  
 
-  // cannot save and run at the same time
-  if(gOptUseFluxProbs && gOptSaveFluxProbsFile){
+  // number of processes used for calculating flux interaction probabilities
+  if( parser.OptionExists("flux-prob-workers") ){
+    gOptNFluxProbWorkers = parser.ArgAsInt("flux-prob-workers");
+    if(gOptNFluxProbWorkers < 1){
+      LOG("gevgen_t2k", pFATAL)
+        << "Invalid number of flux probability workers: " 
+        << gOptNFluxProbWorkers;
+      PrintSyntax();
+      exit(1);
+    }
+  }
+
+  // extending pre-calculated flux interaction probabilities
+  if( parser.OptionExists("extend-flux-probs") ){
+    gOptExtendFluxProbs = true;
+    if(!gOptUseFluxProbs){
+      LOG("gevgen_t2k", pFATAL)
+        << "The --extend-flux-probs option requires the -P option!";
+      PrintSyntax();
+      exit(1);
+    }
+  }
+
+  // cannot save and run at the same time (unless saving an extended set of
+  // pre-calculated flux interaction probabilities)
+  if(gOptUseFluxProbs && gOptSaveFluxProbsFile && !gOptExtendFluxProbs){
     LOG("gevgen_t2k", pFATAL)  
      << "Cannot specify both the -P and -S options at the same time!";
     exit(1); 
   }
+  if(gOptExtendFluxProbs && gOptSaveFluxProbsFile &&
+     gOptSaveFluxProbsFileName == gOptFluxProbFileName){
+    LOG("gevgen_t2k", pFATAL)  
+     << "The extended flux interaction probabilities can not be saved "
+     << "to the input file: " << gOptFluxProbFileName;
+    exit(1); 
+  }
 
   // only makes sense to be setting these options for a realistic flux 
   if(gOptUsingHistFlux && (gOptUseFluxProbs || gOptSaveFluxProbsFile)){
@@ -1461,6 +1514,8 @@ void PrintSyntax(void)
    << "\n           [-t top_volume_name_at_geom]"
    << "\n           [-P pre_gen_prob_file]" 
    << "\n           [-S] [output_name]"
+   << "\n           [--flux-prob-workers n]"
+   << "\n           [--extend-flux-probs]"
    << "\n           [-m max_path_lengths_xml_file]"
    << "\n           [-L length_units_at_geom]"
    << "\n           [-D density_units_at_geom]"
@@ -0,0 +1,260 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestEvGenWorkers
+
+\brief   Program used for testing that events generated by parallel workers
+         (see GMCJWorkerPool) are identical to the events generated by a
+         single process.
+         The same sample of events, at a fixed initial state, is generated
+         by N forked workers and then by a single process. Each event is
+         keyed with RandomGen::SetEventKey(), as in gevgen. The two samples
+         are compared entry by entry (pdg code, status, mothers, daughters
+         and 4-momentum of every GHEP entry and the event weight).
+         The program exits with a non-zero status if any event differs.
+
+         Syntax :
+           gtestEvGenWorkers [-n number_of_events] [-w number_of_workers]
+                             [-p neutrino_pdg] [-t target_pdg] [-e energy]
+                             [--seed random_number_seed]
+                             [--cross-sections xml_file]
+                             [--event-generator-list list_name]
+
+\author  The GENIE Collaboration
+         Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+         STFC, Rutherford Appleton Laboratory
+
+\created October 16, 2026
+
+\cpright Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <string>
+
+#include <TSystem.h>
+#include <TFile.h>
+#include <TTree.h>
+#include <TLorentzVector.h>
+
+#include "EVGCore/EventRecord.h"
+#include "EVGDrivers/GEVGDriver.h"
+#include "EVGDrivers/GMCJWorkerPool.h"
+#include "GHEP/GHepParticle.h"
+#include "Interaction/InitialState.h"
+#include "Messenger/Messenger.h"
+#include "Ntuple/NtpMCEventRecord.h"
+#include "Ntuple/NtpWriter.h"
+#include "Numerical/RandomGen.h"
+#include "PDG/PDGCodes.h"
+#include "Utils/AppInit.h"
+#include "Utils/CmdLnArgParser.h"
+#include "Utils/RunOpt.h"
+
+using std::string;
+
+using namespace genie;
+
+void GetCommandLineArgs (int argc, char ** argv);
+bool Generate           (GEVGDriver & evg_driver, int nworkers, string filename);
+bool SameEvent          (const EventRecord & ev1, const EventRecord & ev2);
+int  Compare            (string filename1, string filename2);
+
+int      gOptNEvents   = 200;
+int      gOptNWorkers  = 4;
+int      gOptNuPdg     = kPdgNuMu;
+int      gOptTgtPdg    = 1000260560;
+double   gOptNuEnergy  = 2.0;
+long int gOptRanSeed   = -1;
+string   gOptXSecFile  = "";
+
+const int kRunNu = 0;
+
+//__________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc, argv);
+
+  utils::app_init::RandGen(gOptRanSeed);
+  utils::app_init::XSecTable(gOptXSecFile, false);
+
+  InitialState init_state(gOptTgtPdg, gOptNuPdg);
+
+  GEVGDriver evg_driver;
+  evg_driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+  evg_driver.SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
+  evg_driver.Configure(init_state);
+
+  string parallel_file = "gtestEvGenWorkers.parallel.ghep.root";
+  string serial_file   = "gtestEvGenWorkers.serial.ghep.root";
+
+  // parallel workers first, so that they do not inherit any state (caches,
+  // random number sequences) left behind by the single process run
+  bool is_worker = Generate(evg_driver, gOptNWorkers, parallel_file);
+  if(is_worker) return 0;
+
+  Generate(evg_driver, 1, serial_file);
+
+  int ndiff = Compare(serial_file, parallel_file);
+  if(ndiff > 0) {
+    LOG("test", pERROR)
+      << ndiff << " of " << gOptNEvents << " events differ between the "
+      << "single process and the " << gOptNWorkers << " workers samples";
+    return 1;
+  }
+
+  LOG("test", pNOTICE)
+    << "The single process and the " << gOptNWorkers
+    << " workers samples are identical";
+
+  gSystem->Unlink(serial_file.c_str());
+  gSystem->Unlink(parallel_file.c_str());
+
+  return 0;
+}
+//__________________________________________________________________________
+bool Generate(GEVGDriver & evg_driver, int nworkers, string filename)
+{
+// Generates the event sample in the given number of workers and merges the
+// worker outputs to the input file. Returns true in parallel workers (which
+// should terminate once done).
+//
+  TLorentzVector nu_p4(0.,0.,gOptNuEnergy,gOptNuEnergy);
+
+  GMCJWorkerPool workers(nworkers);
+  int iworker = workers.Fork();
+
+  if(workers.IsMaster()) {
+    NtpWriter ntpw(kNFGHEP, kRunNu);
+    ntpw.CustomizeFilename(filename);
+    ntpw.Initialize();
+    for(int iw = 0; iw < workers.NWorkers(); iw++) {
+      string wfilename = workers.WorkerFilenamePrefix(filename, iw);
+      if(!ntpw.AddEventRecords(wfilename)) {
+        LOG("test", pFATAL)
+          << "Could not merge the output of worker " << iw;
+        gAbortingInErr = true;
+        exit(1);
+      }
+      gSystem->Unlink(wfilename.c_str());
+    }
+    ntpw.Save();
+    return false;
+  }
+
+  int first_event = workers.FirstEvent(gOptNEvents);
+  int last_event  = first_event + workers.NEvents(gOptNEvents);
+
+  NtpWriter ntpw(kNFGHEP, kRunNu);
+  ntpw.CustomizeFilename(workers.WorkerFilenamePrefix(filename, iworker));
+  ntpw.Initialize();
+
+  int ievent = first_event;
+  int ikeyed = -1;
+  while(ievent < last_event) {
+    if(ievent != ikeyed) {
+      RandomGen::Instance()->SetEventKey(kRunNu, ievent);
+      ikeyed = ievent;
+    }
+    EventRecord * event = evg_driver.GenerateEvent(nu_p4);
+    if(!event) continue;
+    ntpw.AddEventRecord(ievent, event);
+    delete event;
+    ievent++;
+  }
+  ntpw.Save();
+
+  return workers.IsParallel();
+}
+//__________________________________________________________________________
+bool SameEvent(const EventRecord & ev1, const EventRecord & ev2)
+{
+  if(ev1.GetEntries() != ev2.GetEntries()) return false;
+  if(ev1.Weight()     != ev2.Weight()    ) return false;
+
+  for(int i = 0; i < ev1.GetEntries(); i++) {
+    GHepParticle * p1 = ev1.Particle(i);
+    GHepParticle * p2 = ev2.Particle(i);
+    if(p1->Pdg()            != p2->Pdg()           ) return false;
+    if(p1->Status()         != p2->Status()        ) return false;
+    if(p1->FirstMother()    != p2->FirstMother()   ) return false;
+    if(p1->FirstDaughter()  != p2->FirstDaughter() ) return false;
+    if(p1->LastDaughter()   != p2->LastDaughter()  ) return false;
+    if(p1->Px()             != p2->Px()            ) return false;
+    if(p1->Py()             != p2->Py()            ) return false;
+    if(p1->Pz()             != p2->Pz()            ) return false;
+    if(p1->E()              != p2->E()             ) return false;
+  }
+  return true;
+}
+//__________________________________________________________________________
+int Compare(string filename1, string filename2)
+{
+// Returns the number of events that differ between the two samples
+//
+  TFile file1(filename1.c_str(), "READ");
+  TFile file2(filename2.c_str(), "READ");
+
+  TTree * tree1 = dynamic_cast <TTree *> ( file1.Get("gtree") );
+  TTree * tree2 = dynamic_cast <TTree *> ( file2.Get("gtree") );
+  if(!tree1 || !tree2) {
+    LOG("test", pERROR) << "Could not read the generated event trees";
+    return gOptNEvents;
+  }
+
+  NtpMCEventRecord * mcrec1 = 0;
+  NtpMCEventRecord * mcrec2 = 0;
+  tree1->SetBranchAddress("gmcrec", &mcrec1);
+  tree2->SetBranchAddress("gmcrec", &mcrec2);
+
+  int nev1 = (int) tree1->GetEntries();
+  int nev2 = (int) tree2->GetEntries();
+  if(nev1 != gOptNEvents || nev2 != gOptNEvents) {
+    LOG("test", pERROR)
+      << "Expected " << gOptNEvents << " events, got "
+      << nev1 << " (single process) and " << nev2 << " (workers)";
+    return gOptNEvents;
+  }
+
+  int ndiff = 0;
+  for(int i = 0; i < nev1; i++) {
+    tree1->GetEntry(i);
+    tree2->GetEntry(i);
+    if(!SameEvent(*(mcrec1->event), *(mcrec2->event))) {
+      LOG("test", pERROR) << "Event " << i << " differs:";
+      LOG("test", pERROR) << "Single process : " << *(mcrec1->event);
+      LOG("test", pERROR) << "Worker         : " << *(mcrec2->event);
+      ndiff++;
+    }
+    mcrec1->Clear();
+    mcrec2->Clear();
+  }
+  return ndiff;
+}
+//__________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('n') ) gOptNEvents  = parser.ArgAsInt('n');
+  if( parser.OptionExists('w') ) gOptNWorkers = parser.ArgAsInt('w');
+  if( parser.OptionExists('p') ) gOptNuPdg    = parser.ArgAsInt('p');
+  if( parser.OptionExists('t') ) gOptTgtPdg   = parser.ArgAsInt('t');
+  if( parser.OptionExists('e') ) gOptNuEnergy = parser.ArgAsDouble('e');
+  if( parser.OptionExists("seed") ) {
+    gOptRanSeed = parser.ArgAsLong("seed");
+  }
+  if( parser.OptionExists("cross-sections") ) {
+    gOptXSecFile = parser.ArgAsString("cross-sections");
+  }
+
+  LOG("test", pNOTICE)
+    << "Generating " << gOptNEvents << " events (nu: " << gOptNuPdg
+    << ", tgt: " << gOptTgtPdg << ", Ev = " << gOptNuEnergy << " GeV) with "
+    << gOptNWorkers << " workers and with a single process";
+}
+//__________________________________________________________________________
@@ -5,6 +5,8 @@
 
 \brief   Program used for testing / debugging the Interaction and its aggregate 
          objects (InitialState, ProcessInfo, Kinematics, XclsTag)
+         It also times the Kinematics set / get pattern of the kinematics
+         generator rejection loops and the copying of Interaction objects.
 
 \author  Costas Andreopoulos <C.V.Andreopoulos@@rl.ac.uk>
          STFC, Rutherford Appleton Laboratory
@@ -17,6 +19,8 @@
 */
 //____________________________________________________________________________
 
+#include <TStopwatch.h>
+
 #include "Conventions/Constants.h"
 #include "Interaction/Interaction.h"
 #include "Messenger/Messenger.h"
@@ -121,5 +125,41 @@ int main(int /*argc*/, char ** /*argv*/)
 
   LOG("test", pINFO) << "Printing the interaction object after all changes";
   LOG("test", pINFO) << interaction;
+
+  //-- time the kinematics set/get pattern of a DIS/RES rejection loop
+
+  const int ntrials = 1000000;
+  TStopwatch timer;
+
+  timer.Start();
+  double sum = 0;
+  for(int i = 0; i < ntrials; i++) {
+    double x = (i%1000 + 0.5) / 1000.;
+    double y = (i%997  + 0.5) / 997.;
+    wkine->Setx(x);
+    wkine->Sety(y);
+    wkine->SetQ2(2*kNucleonMass*8*x*y);
+    wkine->SetW(kNucleonMass + y);
+    sum += wkine->x() * wkine->y() + wkine->Q2() + wkine->W();
+    wkine->ClearRunningValues();
+  }
+  timer.Stop();
+  LOG("test", pNOTICE) 
+    << "Kinematics set/get/clear cycles: " << ntrials 
+    << " in " << timer.CpuTime() << " s (checksum = " << sum << ")";
+
+  //-- time copying the interaction (as done when selecting interactions)
+
+  timer.Start();
+  for(int i = 0; i < ntrials/10; i++) {
+    Interaction copy(interaction);
+    sum += copy.Kine().x(true);
+  }
+  timer.Stop();
+  LOG("test", pNOTICE) 
+    << "Interaction copies: " << ntrials/10 
+    << " in " << timer.CpuTime() << " s (checksum = " << sum << ")";
+
+  return 0;
 }
 
@@ -3,7 +3,18 @@
 
 \program gtestMessenger
 
-\brief   Program used for testing / debugging log4cpp
+\brief   Program used for testing / debugging log4cpp.
+         If a cross section file is given, it also times the generation of
+         events with GEVGDriver::GenerateEvent(), at a fixed initial state,
+         with the message thresholds of a normal gevgen job. Run it with
+         builds using different message macros or --with-mesg-floor
+         settings to compare the cost of filtered messages per event.
+
+         Syntax :
+           gtestMessenger [--cross-sections xml_file] [-n number_of_events]
+                          [-p neutrino_pdg] [-t target_pdg] [-e energy]
+                          [--seed random_number_seed]
+                          [--event-generator-list list_name]
 
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          STFC, Rutherford Appleton Laboratory
@@ -16,12 +27,38 @@
 */
 //____________________________________________________________________________
 
+#include <string>
+
+#include <TStopwatch.h>
+#include <TLorentzVector.h>
+
+#include "EVGCore/EventRecord.h"
+#include "EVGDrivers/GEVGDriver.h"
+#include "Interaction/InitialState.h"
 #include "Messenger/Messenger.h"
+#include "PDG/PDGCodes.h"
+#include "Utils/AppInit.h"
+#include "Utils/CmdLnArgParser.h"
+#include "Utils/RunOpt.h"
+
+using std::string;
 
 using namespace genie;
 
-int main(int /*argc*/, char ** /*argv*/)
+void GetCommandLineArgs  (int argc, char ** argv);
+void TimeEventGeneration (void);
+
+int      gOptNEvents  = 1000;
+int      gOptNuPdg    = kPdgNuMu;
+int      gOptTgtPdg   = 1000260560;
+double   gOptNuEnergy = 2.0;
+long int gOptRanSeed  = -1;
+string   gOptXSecFile = "";
+
+int main(int argc, char ** argv)
 {
+  GetCommandLineArgs(argc, argv);
+
   LOG("Stream-Name", pFATAL)  << "this is a message with priority: FATAL" ;
   LOG("Stream-Name", pALERT)  << "this is a message with priority: ALERT" ;
   LOG("Stream-Name", pCRIT)   << "this is a message with priority: CRIT"  ;
@@ -61,7 +98,67 @@ int main(int /*argc*/, char ** /*argv*/)
   LOG_NOTICE ("Stream-Name") << "this is yet another message with priority: NOTICE";
   LOG_INFO   ("Stream-Name") << "this is yet another message with priority: INFO"  ;
   LOG_DEBUG  ("Stream-Name") << "this is yet another message with priority: DEBUG" ;
+
+  //-- time event generation with the messages filtered as in gevgen
+
+  if(gOptXSecFile.size() > 0) TimeEventGeneration();
   
   return 0;
 }
+//____________________________________________________________________________
+void TimeEventGeneration(void)
+{
+  utils::app_init::RandGen(gOptRanSeed);
+  utils::app_init::XSecTable(gOptXSecFile, false);
+
+  // the message thresholds of a normal gevgen job 
+  // (the ones set above for testing are only used by the "Stream-Name" stream)
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  InitialState init_state(gOptTgtPdg, gOptNuPdg);
 
+  GEVGDriver evg_driver;
+  evg_driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+  evg_driver.SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
+  evg_driver.Configure(init_state);
+
+  TLorentzVector nu_p4(0.,0.,gOptNuEnergy,gOptNuEnergy);
+
+  // the first event triggers the lazy initialization of the generators
+  EventRecord * event = evg_driver.GenerateEvent(nu_p4);
+  delete event;
+
+  TStopwatch timer;
+
+  timer.Start();
+  for(int iev = 0; iev < gOptNEvents; iev++) {
+    event = evg_driver.GenerateEvent(nu_p4);
+    delete event;
+  }
+  timer.Stop();
+
+  LOG("Stream-Name", pNOTICE) 
+     << "CPU time per GEVGDriver::GenerateEvent() call (" 
+     << gOptNEvents << " events, nu: " << gOptNuPdg << ", tgt: " << gOptTgtPdg
+     << ", Ev = " << gOptNuEnergy << " GeV): " 
+     << 1.E+3 * timer.CpuTime()/gOptNEvents << " ms";
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('n') ) gOptNEvents  = parser.ArgAsInt('n');
+  if( parser.OptionExists('p') ) gOptNuPdg    = parser.ArgAsInt('p');
+  if( parser.OptionExists('t') ) gOptTgtPdg   = parser.ArgAsInt('t');
+  if( parser.OptionExists('e') ) gOptNuEnergy = parser.ArgAsDouble('e');
+  if( parser.OptionExists("seed") ) {
+    gOptRanSeed = parser.ArgAsLong("seed");
+  }
+  if( parser.OptionExists("cross-sections") ) {
+    gOptXSecFile = parser.ArgAsString("cross-sections");
+  }
+}
+//____________________________________________________________________________
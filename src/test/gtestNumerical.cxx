@@ -63,12 +63,14 @@ public:
 void testNumericalIntegration (void);
 void testSplineInterpolation  (void);
 void testSplineOperators      (void);
+void testSplineBatchEval      (void);
 
 int main(int /*argc*/, char ** /*argv*/)
 {
   testNumericalIntegration();
   //testSplineInterpolation();
   //testSplineOperators();
+  testSplineBatchEval();
 
   return 0;
 }
@@ -216,3 +218,34 @@ void testSplineOperators(void)
 //____________________________________________________________________________
 
 
+void testSplineBatchEval(void)
+{
+// check that the batch spline evaluation gives exactly the same results as
+// the single point evaluation and as ROOT's TSpline3 (away from zero knots)
+
+  const int N = 50;
+  double x[N], y[N];
+  for(int i=0; i<N; i++) {
+    x[i] = TMath::Power(10., -2. + 4.*i/(N-1)); // log-spaced, 0.01 - 100
+    y[i] = (i < 5) ? 0. : TMath::Log(x[i]/x[4]) / x[i];
+  }
+  Spline spline(N,x,y);
+
+  const int M = 1000;
+  double xe[M], ye[M];
+  for(int i=0; i<M; i++) {
+    xe[i] = 0.005 + i * (110.-0.005)/(M-1);
+  }
+  spline.Evaluate(xe,ye,M);
+
+  int nfail = 0;
+  for(int i=0; i<M; i++) {
+    double y1 = spline.Evaluate(xe[i]);
+    if(ye[i] != y1) nfail++;
+    bool use_tspl = spline.IsWithinValidRange(xe[i]) && xe[i] > x[5];
+    if(use_tspl && ye[i] != spline.GetAsTSpline()->Eval(xe[i])) nfail++;
+  }
+  LOG("test",pINFO) 
+       << "Batch spline evaluation: " << nfail << " mismatches in " << M << " points";
+}
+//____________________________________________________________________________
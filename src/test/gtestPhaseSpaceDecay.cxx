@@ -0,0 +1,235 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestPhaseSpaceDecay
+
+\brief   Program used for testing / benchmarking the N-body phase space decay
+         generator (NBodyPhaseSpace) and its max weight table.
+         Unweighted decays are generated for a mix of hadronic systems, as 
+         found in KNO hadronization, MEC, nucleon decay and resonance decays,
+         at random invariant masses. The time per decay is compared with the
+         time needed when the max weight is estimated for every decay (as 
+         done before the max weight table was introduced). The fraction of
+         decay weights exceeding the max weight used in the rejection method
+         is also reported.
+
+         Syntax :
+           gtestPhaseSpaceDecay [-n number_of_decays]
+
+\author  The GENIE Collaboration
+         Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+         STFC, Rutherford Appleton Laboratory
+
+\created October 16, 2026
+
+\cpright Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <vector>
+
+#include <TMath.h>
+#include <TRandom3.h>
+#include <TStopwatch.h>
+#include <TLorentzVector.h>
+
+#include "Conventions/Controls.h"
+#include "Messenger/Messenger.h"
+#include "Numerical/RandomGen.h"
+#include "PDG/PDGCodes.h"
+#include "PDG/PDGCodeList.h"
+#include "PDG/PDGLibrary.h"
+#include "Utils/CmdLnArgParser.h"
+#include "Utils/NBodyPhaseSpace.h"
+
+using std::vector;
+
+using namespace genie;
+using namespace genie::controls;
+
+void   GetCommandLineArgs (int argc, char ** argv);
+void   BuildHadronicSystems (void);
+bool   SetDecay (NBodyPhaseSpace & phsp, int isys, TLorentzVector & p4);
+double Benchmark (bool use_table);
+void   CheckMaxWeights (void);
+
+int                   gOptNDecays = 20000;
+vector<PDGCodeList *> gSystems;
+vector<double>        gMassSum;
+
+const double kWmax = 4.0; // max invariant mass of decaying systems (GeV)
+const double kPmax = 5.0; // max momentum of decaying systems (GeV)
+
+const int kNPerDecayWeights = 200; // decays used for a per-decay max weight estimate
+
+//__________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc, argv);
+  BuildHadronicSystems();
+
+  // per-decay max weight estimate
+  double t0 = Benchmark(false);
+  // max weight from table
+  double t1 = Benchmark(true);
+
+  LOG("test", pNOTICE) 
+     << "Time / decay: Per-decay max weight estimate = " << 1E+6*t0 
+     << " usec, Max weight table = " << 1E+6*t1 << " usec";
+  if(t1>0) {
+    LOG("test", pNOTICE) << "Speed-up = " << t0/t1;
+  }
+
+  CheckMaxWeights();
+
+  return 0;
+}
+//__________________________________________________________________________
+void BuildHadronicSystems(void)
+{
+  const int kNSys = 12;
+  const int kNmax = 6;
+  int systems[kNSys][kNmax] = {
+    { kPdgProton,  kPdgPiP,     0,          0,         0,         0 },
+    { kPdgNeutron, kPdgPiP,     0,          0,         0,         0 },
+    { kPdgProton,  kPdgPi0,     kPdgPiP,    0,         0,         0 },
+    { kPdgNeutron, kPdgPiP,     kPdgPiM,    0,         0,         0 },
+    { kPdgProton,  kPdgPiP,     kPdgPiM,    kPdgPi0,   0,         0 },
+    { kPdgNeutron, kPdgPiP,     kPdgPi0,    kPdgPi0,   kPdgPiM,   0 },
+    { kPdgProton,  kPdgPiP,     kPdgPiM,    kPdgPiP,   kPdgPiM,   kPdgPi0 },
+    { kPdgLambda,  kPdgKP,      0,          0,         0,         0 },
+    { kPdgLambda,  kPdgKP,      kPdgPi0,    0,         0,         0 },
+    { kPdgProton,  kPdgKM,      kPdgKP,     kPdgPiP,   0,         0 },
+    { kPdgProton,  kPdgNeutron, 0,          0,         0,         0 },
+    { kPdgProton,  kPdgProton,  kPdgNeutron,0,         0,         0 }
+  };
+
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+
+  for(int isys = 0; isys < kNSys; isys++) {
+    PDGCodeList * pdgv = new PDGCodeList(true);
+    double sum = 0;
+    for(int i = 0; i < kNmax; i++) {
+      int pdgc = systems[isys][i];
+      if(pdgc == 0) break;
+      pdgv->push_back(pdgc);
+      sum += pdglib->Find(pdgc)->Mass();
+    }
+    gSystems.push_back(pdgv);
+    gMassSum.push_back(sum);
+    LOG("test", pNOTICE) << "Hadronic system " << isys << ": " << *pdgv;
+  }
+}
+//__________________________________________________________________________
+bool SetDecay(NBodyPhaseSpace & phsp, int isys, TLorentzVector & p4)
+{
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  RandomGen *  rnd    = RandomGen::Instance();
+
+  const PDGCodeList & pdgv = *gSystems[isys];
+  double sum = gMassSum[isys];
+
+  // random invariant mass & momentum (along z)
+  double W  = sum + (kWmax - sum) * rnd->RndGen().Rndm();
+  double p  = kPmax * rnd->RndGen().Rndm();
+  p4.SetPxPyPzE(0, 0, p, TMath::Sqrt(p*p + W*W));
+
+  int n = pdgv.size();
+  double * mass = new double[n];
+  for(int i = 0; i < n; i++) {
+    mass[i] = pdglib->Find(pdgv[i])->Mass();
+  }
+  bool permitted = phsp.SetDecay(p4, n, mass);
+  delete [] mass;
+
+  return permitted;
+}
+//__________________________________________________________________________
+double Benchmark(bool use_table)
+{
+  RandomGen * rnd = RandomGen::Instance();
+  NBodyPhaseSpace phsp;
+  TLorentzVector p4;
+
+  int nsys = gSystems.size();
+  int nok  = 0;
+
+  TStopwatch timer;
+  timer.Start();
+
+  for(int idecay = 0; idecay < gOptNDecays; idecay++) {
+    int isys = idecay % nsys;
+    if(!SetDecay(phsp, isys, p4)) continue;
+
+    if(use_table) {
+      if(phsp.GenerateUnweighted(rnd->RndDec(), 2.)) nok++;
+    } 
+    else {
+      double wmax = -1;
+      for(int i = 0; i < kNPerDecayWeights; i++) {
+        wmax = TMath::Max(wmax, phsp.Generate());
+      }
+      wmax *= 2;
+      for(unsigned int itry = 1; itry <= kMaxUnweightDecayIterations; itry++) {
+        double w  = phsp.Generate();
+        double gw = wmax * rnd->RndDec().Rndm();
+        if(gw <= w) { nok++; break; }
+      }
+    }
+  }
+
+  timer.Stop();
+
+  LOG("test", pNOTICE) 
+     << (use_table ? "Max weight table" : "Per-decay max weight estimate")
+     << ": Generated " << nok << "/" << gOptNDecays << " unweighted decays in " 
+     << timer.CpuTime() << " sec (CPU)";
+
+  return timer.CpuTime() / gOptNDecays;
+}
+//__________________________________________________________________________
+void CheckMaxWeights(void)
+{
+// Count decay weights exceeding the tabulated max weight (as estimated at
+// the upper edge of the Q bin) and the scaled-up max weight used in the 
+// rejection method, for each hadronic system 
+//
+  NBodyPhaseSpace phsp;
+  TLorentzVector p4;
+
+  const int kNDecaysPerW = 100;
+
+  int nsys = gSystems.size();
+  for(int isys = 0; isys < nsys; isys++) {
+    int ntot   = 0;
+    int nover  = 0;
+    int nover2 = 0;
+    for(int idecay = 0; idecay < gOptNDecays/nsys/kNDecaysPerW; idecay++) {
+      if(!SetDecay(phsp, isys, p4)) continue;
+      double wmax = phsp.MaxWeight();
+      for(int i = 0; i < kNDecaysPerW; i++) {
+        double w = phsp.Generate();
+        ntot++;
+        if(w > wmax)   nover++;
+        if(w > 2*wmax) nover2++;
+      }
+    }
+    LOG("test", pNOTICE) 
+      << "Hadronic system " << isys << ": Fraction of decays with w > wmax = " 
+      << ((ntot>0) ? (double)nover/ntot : 0.) << ", w > 2*wmax = "
+      << ((ntot>0) ? (double)nover2/ntot : 0.) << " (" << ntot << " decays)";
+  }
+}
+//__________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('n') ) {
+    gOptNDecays = parser.ArgAsInt('n');
+  }
+  LOG("test", pNOTICE) << "Number of decays: " << gOptNDecays;
+}
+//__________________________________________________________________________
@@ -0,0 +1,114 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestXSecSplineIO
+
+\brief   Program timing the loading of cross section splines from an XML file
+         and from the equivalent binary spline archive, and checking that
+         both give exactly the same spline knots.
+
+         Syntax :
+           gtestXSecSplineIO -f xml_file [-o binary_archive]
+
+         Options :
+           -f  input XML cross section file
+           -o  binary spline archive to write [default: ./xsec_splines.gspl]
+
+\author  The GENIE Collaboration
+         Contact: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+         STFC, Rutherford Appleton Laboratory
+
+\created October 16, 2026
+
+\cpright Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <TStopwatch.h>
+
+#include "Conventions/XmlParserStatus.h"
+#include "Messenger/Messenger.h"
+#include "Numerical/Spline.h"
+#include "Utils/CmdLnArgParser.h"
+#include "Utils/XSecSplineList.h"
+
+using std::map;
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+  if( !parser.OptionExists('f') ) {
+    LOG("test", pFATAL) << "Syntax: gtestXSecSplineIO -f xml_file [-o binary_archive]";
+    exit(1);
+  }
+  string xmlfile = parser.ArgAsString('f');
+  string binfile = "./xsec_splines.gspl";
+  if( parser.OptionExists('o') ) binfile = parser.ArgAsString('o');
+
+  XSecSplineList * xspl = XSecSplineList::Instance();
+  TStopwatch timer;
+
+  // load the XML file & keep a copy of all knots
+  timer.Start();
+  XmlParserStatus_t ist = xspl->LoadFromXml(xmlfile);
+  timer.Stop();
+  if(ist != kXmlOK) exit(1);
+  double txml = timer.RealTime();
+
+  map<string, vector<double> > knots;
+  const vector<string> * keys = xspl->GetSplineKeys();
+  vector<string>::const_iterator kiter;
+  for(kiter = keys->begin(); kiter != keys->end(); ++kiter) {
+    const Spline * spl = xspl->GetSpline(*kiter);
+    vector<double> & v = knots[*kiter];
+    v.resize(2*spl->NKnots());
+    for(int i = 0; i < spl->NKnots(); i++) spl->GetKnot(i, v[2*i], v[2*i+1]);
+  }
+  delete keys;
+
+  // write the binary archive & load it back
+  xspl->SaveAsBinary(binfile);
+
+  timer.Start();
+  ist = xspl->LoadFromBinary(binfile);
+  timer.Stop();
+  if(ist != kXmlOK) exit(1);
+  double tbin = timer.RealTime();
+
+  // build all splines and compare knots
+  timer.Start();
+  int nfail = 0;
+  map<string, vector<double> >::const_iterator miter;
+  for(miter = knots.begin(); miter != knots.end(); ++miter) {
+    const Spline * spl = xspl->GetSpline(miter->first);
+    const vector<double> & v = miter->second;
+    if(!spl || 2*spl->NKnots() != (int)v.size()) { nfail++; continue; }
+    for(int i = 0; i < spl->NKnots(); i++) {
+      double x = 0, y = 0;
+      spl->GetKnot(i, x, y);
+      if(x != v[2*i] || y != v[2*i+1]) { nfail++; break; }
+    }
+  }
+  timer.Stop();
+  double tbuild = timer.RealTime();
+
+  LOG("test", pNOTICE) << "Number of splines.................: " << knots.size();
+  LOG("test", pNOTICE) << "XML load time (s).................: " << txml;
+  LOG("test", pNOTICE) << "Binary archive load time (s)......: " << tbin;
+  LOG("test", pNOTICE) << "Building all archived splines (s).: " << tbuild;
+  LOG("test", pNOTICE) << "Splines with mismatched knots.....: " << nfail;
+
+  return (nfail == 0) ? 0 : 1;
+}
+//____________________________________________________________________________